@@ -0,0 +1,443 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM                                                                              
+/* file contains the evaluation of blocks of candidate solutions in vector lanes
+/********************************************************************************/
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BATCH_EVALUATOR_X86
+#endif
+
+#include "batchevaluator.h"
+
+#include "pfspinstance.h"
+#include "evaluator.h"
+
+using std::vector;
+
+
+/**********************************************************************************/
+/**
+ * scalar version of the block evaluation, used when the processor has no
+ * vector extensions or when the values of the instance do not fit in 32 bits.
+ * Every lane is evaluated with the same recurrence as the vector kernels.
+ * @param jobsByPosition the jobs of every lane, stored position by position
+ * @param laneWidth the number of lanes in the block
+ * @param nbrOfPositions the number of positions to evaluate
+ * @param nbrOfMachines the number of machines
+ * @param instance the instance to evaluate the candidates on
+ * @param startEndTimes the end times on every machine before the first position
+ * @param cutoff the objective (added to the lanes) above which a lane can stop
+ * @param objectives array in which the objective of every lane gets added
+ * @param pruned array in which is stored whether a lane was stopped early
+ */
+/**********************************************************************************/
+static void evaluateBlockScalar(const std::int32_t* jobsByPosition, int laneWidth, int nbrOfPositions, int nbrOfMachines,
+                                PfspInstance* instance, const long int* startEndTimes, long int cutoff,
+                                long int* objectives, bool* pruned){
+    const long int* dueDates = instance->getDueDates();
+    const long int* priorities = instance->getPriorities();
+    vector<long int> endTimes(nbrOfMachines);
+
+    for(int lane = 0; lane < laneWidth; ++lane){
+        std::copy_n(startEndTimes, nbrOfMachines, endTimes.begin());
+        long int objective = 0;
+
+        for(int p = 0; p < nbrOfPositions; ++p){
+            const int job = jobsByPosition[p * laneWidth + lane];
+            const ProcessTime* processTimes = instance->getJobProcessTimes(job);
+            long int endTime = endTimes[0] + processTimes[0];
+            endTimes[0] = endTime;
+            for(int m = 1; m < nbrOfMachines; ++m){
+                endTime = std::max(endTime, endTimes[m]) + processTimes[m];
+                endTimes[m] = endTime;
+            }
+            objective += std::max(endTime - dueDates[job], 0l) * priorities[job];
+            if(objective > cutoff && p < nbrOfPositions - 1){
+                pruned[lane] = true;
+                break;
+            }
+        }
+        objectives[lane] += objective;
+    }
+}
+
+
+#ifdef BATCH_EVALUATOR_X86
+
+/**********************************************************************************/
+/**
+ * AVX2 version of the block evaluation, runs the recurrence for 8 candidates at
+ * once. The processing times, due dates and weights of the jobs in the lanes are
+ * gathered from the machine-major table. A lane whose weighted tardiness exceeds
+ * the cutoff before the last position is pruned as in the scalar kernel: its
+ * objective stops growing and the block stops once all lanes are pruned.
+ * @tparam FIXED_MACHINES the number of machines known at compile time, so that
+ *                        the end times can stay in registers, or 0 for any number
+ * (parameters as in evaluateBlockScalar, with the 32 bit due dates and weights)
+ */
+/**********************************************************************************/
+template <int FIXED_MACHINES>
+__attribute__((target("avx2")))
+static void evaluateBlockAvx2(const std::int32_t* jobsByPosition, int nbrOfPositions, int nbrOfMachines,
+                              PfspInstance* instance, const std::int32_t* dueDates, const std::int32_t* priorities,
+                              const long int* startEndTimes, std::int32_t cutoff, long int* objectives, bool* pruned){
+    const int machines = (FIXED_MACHINES > 0) ? FIXED_MACHINES : nbrOfMachines;
+    __m256i endTimes[(FIXED_MACHINES > 0) ? FIXED_MACHINES : MAX_BATCH_MACHINES];
+    for(int m = 0; m < machines; ++m)
+        endTimes[m] = _mm256_set1_epi32(static_cast<std::int32_t>(startEndTimes[m]));
+
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i cutoffs = _mm256_set1_epi32(cutoff);
+    __m256i objective = zero;
+    __m256i prunedLanes = zero;
+
+    for(int p = 0; p < nbrOfPositions; ++p){
+        const __m256i jobs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(jobsByPosition + p * 8));
+
+        __m256i endTime = _mm256_add_epi32(endTimes[0], 
+            _mm256_i32gather_epi32(instance->getMachineProcessTimes(1), jobs, 4));
+        endTimes[0] = endTime;
+        for(int m = 1; m < machines; ++m){
+            endTime = _mm256_add_epi32(_mm256_max_epi32(endTime, endTimes[m]),
+                _mm256_i32gather_epi32(instance->getMachineProcessTimes(m + 1), jobs, 4));
+            endTimes[m] = endTime;
+        }
+
+        const __m256i tardiness = _mm256_max_epi32(_mm256_sub_epi32(endTime, _mm256_i32gather_epi32(dueDates, jobs, 4)), zero);
+        const __m256i weightedTardiness = _mm256_mullo_epi32(tardiness, _mm256_i32gather_epi32(priorities, jobs, 4));
+        objective = _mm256_add_epi32(objective, _mm256_andnot_si256(prunedLanes, weightedTardiness));
+
+        if(p < nbrOfPositions - 1){
+            prunedLanes = _mm256_or_si256(prunedLanes, _mm256_cmpgt_epi32(objective, cutoffs));
+            if(_mm256_movemask_epi8(prunedLanes) == -1) break;
+        }
+    }
+
+    alignas(32) std::int32_t lanes[8];
+    alignas(32) std::int32_t prunedMasks[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), objective);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(prunedMasks), prunedLanes);
+    for(int lane = 0; lane < 8; ++lane){
+        objectives[lane] += lanes[lane];
+        pruned[lane] = prunedMasks[lane] != 0;
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * AVX-512 version of the block evaluation, runs the recurrence for 16
+ * candidates at once.
+ * (parameters as in evaluateBlockAvx2)
+ */
+/**********************************************************************************/
+template <int FIXED_MACHINES>
+__attribute__((target("avx512f")))
+static void evaluateBlockAvx512(const std::int32_t* jobsByPosition, int nbrOfPositions, int nbrOfMachines,
+                                PfspInstance* instance, const std::int32_t* dueDates, const std::int32_t* priorities,
+                                const long int* startEndTimes, std::int32_t cutoff, long int* objectives, bool* pruned){
+    const int machines = (FIXED_MACHINES > 0) ? FIXED_MACHINES : nbrOfMachines;
+    __m512i endTimes[(FIXED_MACHINES > 0) ? FIXED_MACHINES : MAX_BATCH_MACHINES];
+    for(int m = 0; m < machines; ++m)
+        endTimes[m] = _mm512_set1_epi32(static_cast<std::int32_t>(startEndTimes[m]));
+
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i cutoffs = _mm512_set1_epi32(cutoff);
+    __m512i objective = zero;
+    __mmask16 prunedLanes = 0;
+
+    for(int p = 0; p < nbrOfPositions; ++p){
+        const __m512i jobs = _mm512_loadu_si512(jobsByPosition + p * 16);
+
+        __m512i endTime = _mm512_add_epi32(endTimes[0],
+            _mm512_i32gather_epi32(jobs, instance->getMachineProcessTimes(1), 4));
+        endTimes[0] = endTime;
+        for(int m = 1; m < machines; ++m){
+            endTime = _mm512_add_epi32(_mm512_max_epi32(endTime, endTimes[m]),
+                _mm512_i32gather_epi32(jobs, instance->getMachineProcessTimes(m + 1), 4));
+            endTimes[m] = endTime;
+        }
+
+        const __m512i tardiness = _mm512_max_epi32(_mm512_sub_epi32(endTime, _mm512_i32gather_epi32(jobs, dueDates, 4)), zero);
+        const __m512i weightedTardiness = _mm512_mullo_epi32(tardiness, _mm512_i32gather_epi32(jobs, priorities, 4));
+        objective = _mm512_mask_add_epi32(objective, static_cast<__mmask16>(~prunedLanes), objective, weightedTardiness);
+
+        if(p < nbrOfPositions - 1){
+            prunedLanes |= _mm512_cmpgt_epi32_mask(objective, cutoffs);
+            if(prunedLanes == 0xFFFF) break;
+        }
+    }
+
+    alignas(64) std::int32_t lanes[16];
+    _mm512_store_si512(lanes, objective);
+    for(int lane = 0; lane < 16; ++lane){
+        objectives[lane] += lanes[lane];
+        pruned[lane] = (prunedLanes >> lane) & 1;
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * runs the vector kernel of the given instruction set
+ * @tparam FIXED_MACHINES the number of machines known at compile time, or 0
+ * (parameters as in evaluateBlockAvx2)
+ */
+/**********************************************************************************/
+template <int FIXED_MACHINES>
+static void evaluateBlockVector(InstructionSet instructionSet, const std::int32_t* jobsByPosition, int nbrOfPositions, int nbrOfMachines,
+                                PfspInstance* instance, const std::int32_t* dueDates, const std::int32_t* priorities,
+                                const long int* startEndTimes, std::int32_t cutoff, long int* objectives, bool* pruned){
+    if(instructionSet == AVX512_LANES)
+        evaluateBlockAvx512<FIXED_MACHINES>(jobsByPosition, nbrOfPositions, nbrOfMachines, instance,
+                                            dueDates, priorities, startEndTimes, cutoff, objectives, pruned);
+    else
+        evaluateBlockAvx2<FIXED_MACHINES>(jobsByPosition, nbrOfPositions, nbrOfMachines, instance,
+                                          dueDates, priorities, startEndTimes, cutoff, objectives, pruned);
+}
+
+#endif
+
+
+/**********************************************************************************/
+/**
+ * constructor of an evaluator that computes the weighted tardiness of blocks of
+ * candidate solutions, with one candidate per vector lane. The vector kernels
+ * work on 32 bit values, when the weighted tardiness of the instance could
+ * exceed 32 bits (or the number of machines is too large) the scalar kernel is
+ * used, so that all kernels produce identical results.
+ * @param instance the instance the candidates belong to
+ * @param instructionSet the instruction set to use, AUTOMATIC selects the widest
+ *                       one supported by the processor
+ */
+/**********************************************************************************/
+BatchEvaluator::BatchEvaluator(PfspInstance & instance, InstructionSet instructionSet){
+    this->instance = &instance;
+    this->nbrOfJobs = instance.getNbrOfJobs();
+    this->nbrOfMachines = instance.getNbrOfMachines();
+
+    // check that every intermediate value of the vector kernels fits in 32 bits
+    long int maxCompletionTime = 0;
+    long int maxPriority = 0;
+    dueDates.assign(nbrOfJobs + 1, 0);
+    priorities.assign(nbrOfJobs + 1, 0);
+    for(int job = 1; job <= nbrOfJobs; ++job){
+        maxCompletionTime += instance.getSumOfProcessTimes(job);
+        maxPriority = std::max(maxPriority, instance.getPriority(job));
+        dueDates[job] = static_cast<std::int32_t>(instance.getDueDate(job));
+        priorities[job] = static_cast<std::int32_t>(instance.getPriority(job));
+    }
+    const double maxObjective = static_cast<double>(maxCompletionTime) * maxPriority * nbrOfJobs;
+    const bool fitsInLanes = maxObjective < std::numeric_limits<std::int32_t>::max() && 
+                             nbrOfMachines <= MAX_BATCH_MACHINES;
+
+    // select the widest instruction set that is both requested and supported
+    bool supportsAvx2 = false, supportsAvx512 = false;
+#ifdef BATCH_EVALUATOR_X86
+    supportsAvx2 = __builtin_cpu_supports("avx2");
+    supportsAvx512 = __builtin_cpu_supports("avx512f");
+#endif
+    if(instructionSet == AUTOMATIC)
+        instructionSet = supportsAvx512 ? AVX512_LANES : (supportsAvx2 ? AVX2_LANES : SCALAR_LANES);
+    if((instructionSet == AVX512_LANES && !supportsAvx512) || 
+       (instructionSet == AVX2_LANES && !supportsAvx2) ||
+       !fitsInLanes)
+        instructionSet = SCALAR_LANES;
+
+    this->instructionSet = instructionSet;
+    switch(instructionSet){
+        case AVX512_LANES: laneWidth = 16; break;
+        case AVX2_LANES: laneWidth = 8; break;
+        default: laneWidth = 8;
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * destructor
+ */
+/**********************************************************************************/
+BatchEvaluator::~BatchEvaluator(){
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the instruction set used by the evaluator
+ */
+/**********************************************************************************/
+InstructionSet BatchEvaluator::getInstructionSet(){
+    return instructionSet;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the number of candidates that are evaluated together
+ */
+/**********************************************************************************/
+int BatchEvaluator::getLaneWidth(){
+    return laneWidth;
+}
+
+
+/**********************************************************************************/
+/**
+ * evaluates the block of candidates stored in jobsByPosition with the
+ * selected kernel
+ * @param nbrOfPositions the number of positions to evaluate
+ * @param startEndTimes the end times on every machine before the first position
+ * @param startObjective the objective of the jobs before the first position
+ * @param cutoff the objective above which the exact value is not needed
+ * @param objectives array in which the objective of every lane is stored
+ * @param pruned array in which is stored whether a lane was stopped early
+ */
+/**********************************************************************************/
+void BatchEvaluator::evaluateBlock(int nbrOfPositions, const long int* startEndTimes, long int startObjective,
+                                   long int cutoff, long int* objectives, bool* pruned){
+    // the lanes only sum the objective of the evaluated positions
+    const long int laneCutoff = (cutoff == NO_CUTOFF) ? NO_CUTOFF : cutoff - startObjective;
+    const std::int32_t vectorCutoff = static_cast<std::int32_t>(
+        std::clamp(laneCutoff, -1l, static_cast<long int>(std::numeric_limits<std::int32_t>::max())));
+
+    std::fill_n(objectives, laneWidth, startObjective);
+    std::fill_n(pruned, laneWidth, false);
+
+    // the jobs before the first position already exceed the cutoff: every lane is
+    // pruned, as it would be by a block that starts earlier
+    if(laneCutoff < 0 && nbrOfPositions > 0){
+        std::fill_n(pruned, laneWidth, true);
+        return;
+    }
+    if(instructionSet == SCALAR_LANES){
+        evaluateBlockScalar(jobsByPosition.data(), laneWidth, nbrOfPositions, nbrOfMachines, 
+                            instance, startEndTimes, laneCutoff, objectives, pruned);
+        return;
+    }
+
+#ifdef BATCH_EVALUATOR_X86
+    // use the kernel specialised for the shape of the instance, if any
+    switch(nbrOfMachines){
+        case 5: 
+            evaluateBlockVector<5>(instructionSet, jobsByPosition.data(), nbrOfPositions, nbrOfMachines, instance,
+                                   dueDates.data(), priorities.data(), startEndTimes, vectorCutoff, objectives, pruned);
+            break;
+        case 10: 
+            evaluateBlockVector<10>(instructionSet, jobsByPosition.data(), nbrOfPositions, nbrOfMachines, instance,
+                                    dueDates.data(), priorities.data(), startEndTimes, vectorCutoff, objectives, pruned);
+            break;
+        case 20: 
+            evaluateBlockVector<20>(instructionSet, jobsByPosition.data(), nbrOfPositions, nbrOfMachines, instance,
+                                    dueDates.data(), priorities.data(), startEndTimes, vectorCutoff, objectives, pruned);
+            break;
+        default:
+            evaluateBlockVector<0>(instructionSet, jobsByPosition.data(), nbrOfPositions, nbrOfMachines, instance,
+                                   dueDates.data(), priorities.data(), startEndTimes, vectorCutoff, objectives, pruned);
+    }
+#endif
+}
+
+
+/**********************************************************************************/
+/**
+ * computes the weighted tardiness of a number of candidate solutions. The 
+ * candidates are evaluated in blocks of laneWidth candidates, every block
+ * starts from the cached end times at the first position in which one of its
+ * candidates differs from the sequence in the cache.
+ * @param cache cache containing the sequence the candidates are derived from
+ * @param candidates pointers to the candidate solutions (prefixed with job 0)
+ * @param count the number of candidates
+ * @param objectives array in which the weighted tardiness of every candidate is stored
+ * @param cutoff optional objective above which the exact value is not needed, a
+ *               candidate stops as soon as the objective of its jobs before the
+ *               last position exceeds it, on every instruction set
+ * @param pruned optional array in which is stored whether the evaluation of a
+ *               candidate was stopped early, its objective is then a lower bound
+ */
+/**********************************************************************************/
+void BatchEvaluator::evaluate(CompletionTimesCache & cache, const vector<int>* const* candidates, int count, long int* objectives,
+                              long int cutoff, bool* pruned){
+    long int blockObjectives[MAX_LANE_WIDTH];
+    bool blockPruned[MAX_LANE_WIDTH];
+
+    for(int first = 0; first < count; first += laneWidth){
+        const int blockSize = std::min(laneWidth, count - first);
+        const int solSize = candidates[first]->size();
+
+        // the block starts at the first position that differs for any of its candidates
+        int from = solSize;
+        for(int lane = 0; lane < blockSize; ++lane)
+            from = std::min(from, cache.getFirstDifference(*candidates[first + lane]));
+        from = std::max(from, 1);
+        const int nbrOfPositions = solSize - from;
+
+        // transpose the block, unused lanes repeat the first candidate
+        jobsByPosition.resize(static_cast<std::size_t>(std::max(nbrOfPositions, 1)) * laneWidth);
+        for(int lane = 0; lane < laneWidth; ++lane){
+            const vector<int> & candidate = *candidates[first + (lane < blockSize ? lane : 0)];
+            for(int p = 0; p < nbrOfPositions; ++p)
+                jobsByPosition[p * laneWidth + lane] = candidate[from + p];
+        }
+
+        evaluateBlock(nbrOfPositions, cache.getCompletionTimes(from - 1), cache.getPrefixObjective(from - 1),
+                      cutoff, blockObjectives, blockPruned);
+        std::copy_n(blockObjectives, blockSize, objectives + first);
+        if(pruned) std::copy_n(blockPruned, blockSize, pruned + first);
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * computes the weighted tardiness of the neighbours obtained by applying a
+ * number of moves to the sequence in the cache. The neighbours are never
+ * constructed, the jobs of every lane are read from the cached sequence and
+ * the move.
+ * @param cache cache containing the sequence the moves apply to
+ * @param moves the moves to evaluate
+ * @param count the number of moves
+ * @param objectives array in which the weighted tardiness of every neighbour is stored
+ * @param cutoff optional objective above which the exact value is not needed, a
+ *               neighbour stops as soon as the objective of its jobs before the
+ *               last position exceeds it, on every instruction set
+ * @param pruned optional array in which is stored whether the evaluation of a
+ *               neighbour was stopped early, its objective is then a lower bound
+ */
+/**********************************************************************************/
+void BatchEvaluator::evaluate(CompletionTimesCache & cache, const Move* moves, int count, long int* objectives,
+                              long int cutoff, bool* pruned){
+    long int blockObjectives[MAX_LANE_WIDTH];
+    bool blockPruned[MAX_LANE_WIDTH];
+    const vector<int> & sequence = cache.getSequence();
+    const int solSize = sequence.size();
+
+    for(int first = 0; first < count; first += laneWidth){
+        const int blockSize = std::min(laneWidth, count - first);
+
+        // the block starts at the first position changed by any of its moves
+        int from = solSize;
+        for(int lane = 0; lane < blockSize; ++lane)
+            from = std::min(from, moves[first + lane].first);
+        from = std::max(from, 1);
+        const int nbrOfPositions = solSize - from;
+
+        // transpose the block, unused lanes repeat the first move
+        jobsByPosition.resize(static_cast<std::size_t>(std::max(nbrOfPositions, 1)) * laneWidth);
+        for(int lane = 0; lane < laneWidth; ++lane){
+            const Move & move = moves[first + (lane < blockSize ? lane : 0)];
+            for(int p = 0; p < nbrOfPositions; ++p)
+                jobsByPosition[p * laneWidth + lane] = getJobAfterMove(sequence, move, from + p);
+        }
+
+        evaluateBlock(nbrOfPositions, cache.getCompletionTimes(from - 1), cache.getPrefixObjective(from - 1),
+                      cutoff, blockObjectives, blockPruned);
+        std::copy_n(blockObjectives, blockSize, objectives + first);
+        if(pruned) std::copy_n(blockPruned, blockSize, pruned + first);
+    }
+}
@@ -0,0 +1,62 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM                                                                              
+/* headerfile for batchevaluator.cpp
+/********************************************************************************/
+#ifndef _BATCHEVALUATOR_H_
+#define _BATCHEVALUATOR_H_
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+#include "pfspinstance.h"
+#include "evaluator.h"
+#include "neighbourhood.h"
+
+using std::vector, std::string;
+
+// instruction sets the batch evaluator can run on, AUTOMATIC selects the widest
+// one supported by the processor
+enum InstructionSet {AUTOMATIC, SCALAR_LANES, AVX2_LANES, AVX512_LANES};
+const string INSTRUCTION_SET_STRINGS[4] {"AUTOMATIC","SCALAR","AVX2","AVX512"};
+
+// the maximal number of candidates evaluated together and the maximal number of
+// machines for which the machine end times are kept in vector registers
+const int MAX_LANE_WIDTH = 16;
+const int MAX_BATCH_MACHINES = 64;
+
+
+// class definition
+class BatchEvaluator{
+    private:
+        PfspInstance* instance;
+        InstructionSet instructionSet;
+        int laneWidth;
+        int nbrOfJobs;
+        int nbrOfMachines;
+
+        // 32 bit copies of the due dates and weights, used by the vector gathers
+        vector<std::int32_t> dueDates;
+        vector<std::int32_t> priorities;
+
+        // jobs of the candidates of one block, stored position by position
+        // with one lane per candidate
+        vector<std::int32_t> jobsByPosition;
+
+        void evaluateBlock(int nbrOfPositions, const long int* startEndTimes, long int startObjective,
+                           long int cutoff, long int* objectives, bool* pruned);
+
+    public:
+        BatchEvaluator(PfspInstance & instance, InstructionSet instructionSet = AUTOMATIC);
+        ~BatchEvaluator();
+
+        InstructionSet getInstructionSet();
+        int getLaneWidth();
+
+        void evaluate(CompletionTimesCache & cache, const vector<int>* const* candidates, int count, long int* objectives,
+                      long int cutoff = NO_CUTOFF, bool* pruned = nullptr);
+        void evaluate(CompletionTimesCache & cache, const Move* moves, int count, long int* objectives,
+                      long int cutoff = NO_CUTOFF, bool* pruned = nullptr);
+};
+
+#endif
@@ -0,0 +1,263 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM                                                                              
+/* file contains a blocked Bloom filter of permutation hashes with a fixed memory 
+/* footprint. All bits of a hash are set in one block of one cache line. When the 
+/* number of insertions reaches the point where the false positive rate exceeds
+/* its target, the filter is cleared. Clearing only starts a new epoch, a block is
+/* emptied when it is first written in the new epoch.
+/********************************************************************************/
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+
+#include "bloomfilter.h"
+
+using std::vector;
+
+
+/**********************************************************************************/
+/**
+ * mixes the bits of a hash (splitmix64 finalizer), so that the block and the bit
+ * positions do not depend on the correlated low bits of the permutation hashes
+ * @param hash the hash to mix
+ * @return the mixed hash
+ */
+/**********************************************************************************/
+static inline std::uint64_t mixHash(std::uint64_t hash){
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+    return hash ^ (hash >> 31);
+}
+
+
+/**********************************************************************************/
+/**
+ * returns the next bit position within a block. Every position takes 9 fresh bits
+ * of a stream of mixed bits, so that the positions of a hash are independent. The
+ * stream is refilled from the mixed hash itself, the 1 bit left over after 7 
+ * positions would give every hash the same later positions.
+ * @param mixed the mixed hash
+ * @param bits the remaining bits of the stream, refilled every 7 positions
+ * @param index the index of the position
+ * @return the bit position within the block
+ */
+/**********************************************************************************/
+static inline int getBitPosition(std::uint64_t mixed, std::uint64_t & bits, int index){
+    if(index % 7 == 0) bits = mixHash(mixed + index + 1);
+    const int bit = bits % BLOOM_BLOCK_BITS;
+    bits /= BLOOM_BLOCK_BITS;
+    return bit;
+}
+
+
+/**********************************************************************************/
+/**
+ * constructor of an empty filter
+ * @param byteBudget the number of bytes of the filter and the epochs of its blocks,
+ *                   at least one block is used
+ * @param falsePositiveRate the false positive rate the filter may reach
+ */
+/**********************************************************************************/
+BlockedBloomFilter::BlockedBloomFilter(long int byteBudget, double falsePositiveRate){
+    nbrOfBlocks = std::max(1L, static_cast<long int>(byteBudget / (BLOOM_BLOCK_WORDS * 8 + sizeof(std::uint32_t))));
+    words.assign(nbrOfBlocks * BLOOM_BLOCK_WORDS, 0);
+    blockEpochs.assign(nbrOfBlocks, 0);
+    epoch = 0;
+
+    // the optimal number of bits per hash is -log2(p), the capacity is the largest 
+    // number of insertions for which the expected rate stays below p. At 2 insertions
+    // per bit and hash the rate is far above p, the search starts below that.
+    nbrOfHashes = std::clamp(static_cast<int>(std::ceil(-std::log2(falsePositiveRate))), 1, 16);
+    nbrOfClears = 0;
+    nbrOfEvictions = 0;
+    long int low = 1;
+    long int high = std::max(1L, 2 * nbrOfBlocks * BLOOM_BLOCK_BITS / nbrOfHashes);
+    while(low < high){
+        nbrOfInsertions = (low + high + 1) / 2;
+        if(getFalsePositiveRate() <= falsePositiveRate) low = nbrOfInsertions;
+        else high = nbrOfInsertions - 1;
+    }
+    capacity = low;
+    nbrOfInsertions = 0;
+}
+
+
+/**********************************************************************************/
+/**
+ * destructor
+ */
+/**********************************************************************************/
+BlockedBloomFilter::~BlockedBloomFilter(){
+}
+
+
+/**********************************************************************************/
+/**
+ * checks whether a hash was (probably) inserted before
+ * @param hash the permutation hash
+ * @return false if the hash was certainly not inserted since the last clear
+ */
+/**********************************************************************************/
+bool BlockedBloomFilter::contains(std::uint64_t hash){
+    const std::uint64_t mixed = mixHash(hash);
+    const long int blockIndex = (mixed >> 32) % nbrOfBlocks;
+    if(blockEpochs[blockIndex] != epoch) return false;
+    const std::uint64_t* block = words.data() + blockIndex * BLOOM_BLOCK_WORDS;
+    std::uint64_t bits = mixed;
+
+    for(int i = 0; i < nbrOfHashes; ++i){
+        const int bit = getBitPosition(mixed, bits, i);
+        if(!(block[bit / 64] & (1ULL << (bit % 64)))) return false;
+    }
+    return true;
+}
+
+
+/**********************************************************************************/
+/**
+ * inserts a hash, the filter is cleared first when it is at capacity
+ * @param hash the permutation hash
+ */
+/**********************************************************************************/
+void BlockedBloomFilter::insert(std::uint64_t hash){
+    if(nbrOfInsertions >= capacity) clear();
+
+    const std::uint64_t mixed = mixHash(hash);
+    const long int blockIndex = (mixed >> 32) % nbrOfBlocks;
+    std::uint64_t* block = words.data() + blockIndex * BLOOM_BLOCK_WORDS;
+    if(blockEpochs[blockIndex] != epoch){
+        std::fill(block, block + BLOOM_BLOCK_WORDS, 0);
+        blockEpochs[blockIndex] = epoch;
+    }
+    std::uint64_t bits = mixed;
+
+    for(int i = 0; i < nbrOfHashes; ++i){
+        const int bit = getBitPosition(mixed, bits, i);
+        block[bit / 64] |= 1ULL << (bit % 64);
+    }
+    ++nbrOfInsertions;
+}
+
+
+/**********************************************************************************/
+/**
+ * removes all hashes by starting a new epoch. When the epoch wraps around, the
+ * blocks of the old epochs are emptied so that none of them looks current.
+ */
+/**********************************************************************************/
+void BlockedBloomFilter::clear(){
+    nbrOfEvictions += nbrOfInsertions;
+    nbrOfInsertions = 0;
+    ++nbrOfClears;
+    if(++epoch == 0){
+        std::fill(words.begin(), words.end(), 0);
+        std::fill(blockEpochs.begin(), blockEpochs.end(), 0);
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the number of insertions since the last clear
+ */
+/**********************************************************************************/
+long int BlockedBloomFilter::size(){
+    return nbrOfInsertions;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the number of insertions after which the filter is cleared
+ */
+/**********************************************************************************/
+long int BlockedBloomFilter::getCapacity(){
+    return capacity;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the number of times the filter was cleared
+ */
+/**********************************************************************************/
+long int BlockedBloomFilter::getNbrOfClears(){
+    return nbrOfClears;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the number of insertions that were removed by clearing the filter
+ */
+/**********************************************************************************/
+long int BlockedBloomFilter::getNbrOfEvictions(){
+    return nbrOfEvictions;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the number of bytes of the filter and the epochs of its blocks
+ */
+/**********************************************************************************/
+long int BlockedBloomFilter::getBytes(){
+    return words.size() * sizeof(std::uint64_t) + blockEpochs.size() * sizeof(std::uint32_t);
+}
+
+
+/**********************************************************************************/
+/**
+ * the false positive rate of a block with a number of hashes. The distribution of
+ * the number of set bits of a block is followed one bit position at a time, the 
+ * rate is the chance that all positions of a query hit set bits. The rates are 
+ * kept, they do not depend on the number of insertions.
+ * @param load the number of hashes in the block
+ * @return the false positive rate of the block
+ */
+/**********************************************************************************/
+double BlockedBloomFilter::getBlockRate(long int load){
+    if(setBitsProbabilities.empty()){
+        setBitsProbabilities.assign(BLOOM_BLOCK_BITS + 1, 0);
+        setBitsProbabilities[0] = 1;
+    }
+    while(blockRates.size() <= load){
+        double blockRate = 0;
+        for(int setBits = 0; setBits <= BLOOM_BLOCK_BITS; ++setBits)
+            blockRate += setBitsProbabilities[setBits] * std::pow(static_cast<double>(setBits) / BLOOM_BLOCK_BITS, nbrOfHashes);
+        blockRates.push_back(blockRate);
+
+        // the positions of one more hash, a position hits a set bit or sets a new one
+        for(int i = 0; i < nbrOfHashes; ++i)
+            for(int setBits = BLOOM_BLOCK_BITS - 1; setBits >= 0; --setBits){
+                const double newBit = setBitsProbabilities[setBits] * (BLOOM_BLOCK_BITS - setBits) / BLOOM_BLOCK_BITS;
+                setBitsProbabilities[setBits + 1] += newBit;
+                setBitsProbabilities[setBits] -= newBit;
+            }
+    }
+    return blockRates[load];
+}
+
+
+/**********************************************************************************/
+/**
+ * estimates the current false positive rate from the number of insertions. The
+ * number of hashes in a block follows a Poisson distribution, the rate is the
+ * rate of a block averaged over that distribution. The rate of a block is the 
+ * exact rate for its number of hashes: the rate of the expected number of set bits
+ * would underestimate it, a block with more set bits than expected weighs more.
+ * @return the estimated false positive rate
+ */
+/**********************************************************************************/
+double BlockedBloomFilter::getFalsePositiveRate(){
+    const double meanLoad = static_cast<double>(nbrOfInsertions) / nbrOfBlocks;
+    const long int maxLoad = static_cast<long int>(meanLoad + 10 * std::sqrt(meanLoad) + 20);
+    double rate = 0;
+    double probability = std::exp(-meanLoad);
+    for(long int load = 0; load <= maxLoad; ++load){
+        rate += probability * getBlockRate(load);
+        probability *= meanLoad / (load + 1);
+    }
+    return rate;
+}
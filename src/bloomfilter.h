@@ -0,0 +1,60 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM                                                                              
+/* headerfile for bloomfilter.cpp
+/********************************************************************************/
+#ifndef _BLOOMFILTER_H_
+#define _BLOOMFILTER_H_
+
+#include <vector>
+#include <cstdint>
+
+using std::vector;
+
+// number of 64 bit words in a block, one block spans one cache line
+const int BLOOM_BLOCK_WORDS = 8;
+const int BLOOM_BLOCK_BITS = BLOOM_BLOCK_WORDS * 64;
+
+
+// class definition
+class BlockedBloomFilter{
+    private:
+        vector<std::uint64_t> words;
+        long int nbrOfBlocks;
+        int nbrOfHashes;
+
+        // a block is empty unless it was written in the current epoch, so that the
+        // filter is cleared without touching its memory
+        vector<std::uint32_t> blockEpochs;
+        std::uint32_t epoch;
+
+        // number of insertions after which the false positive rate reaches its
+        // target and the filter is cleared
+        long int capacity;
+        long int nbrOfInsertions;
+        long int nbrOfClears;
+        long int nbrOfEvictions;
+
+        // the false positive rate of a block per number of hashes in it, and the
+        // distribution of the set bits of a block with the next number of hashes
+        vector<double> blockRates;
+        vector<double> setBitsProbabilities;
+
+        double getBlockRate(long int load);
+
+    public:
+        BlockedBloomFilter(long int byteBudget, double falsePositiveRate);
+        ~BlockedBloomFilter();
+
+        bool contains(std::uint64_t hash);
+        void insert(std::uint64_t hash);
+        void clear();
+
+        long int size();
+        long int getCapacity();
+        long int getNbrOfClears();
+        long int getNbrOfEvictions();
+        long int getBytes();
+        double getFalsePositiveRate();
+};
+
+#endif
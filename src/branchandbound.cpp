@@ -0,0 +1,522 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* file contains the exact branch and bound solver for small instances. It searches
+/* the partial sequences depth first, appending one job at a time. A partial
+/* sequence is cut off when its lower bound on the weighted tardiness of every
+/* completion is not below the best schedule found so far, which starts as the
+/* SRZ heuristic improved by a short descent. The lower bound assigns the remaining
+/* jobs to the remaining positions: a job can not finish before it could finish
+/* right after the partial sequence, and the job on a position can not finish
+/* before the jobs on the positions in front of it fit on every machine. A partial
+/* sequence is also cut off when swapping its last two jobs, or another order of the
+/* same jobs seen before, finishes no later on every machine with no more weighted
+/* tardiness. The subtrees of the first two jobs are explored in parallel. When the
+/* search completes, the best schedule is optimal, when it stops on the deadline
+/* the lowest lower bound of the subtrees left unexplored bounds the optimum.
+/********************************************************************************/
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <memory>
+#include <functional>
+#include <cmath>
+
+#include "branchandbound.h"
+
+#include "constants.h"
+#include "helpers.h"
+#include "initsolution.h"
+#include "neighbourhood.h"
+#include "evaluator.h"
+#include "descent.h"
+#include "threadpool.h"
+
+
+/**********************************************************************************/
+/**
+ * @param pfspInstance the instance
+ * @param job the job
+ * @param completionTime the completion time of the job on the last machine
+ * @return the weighted tardiness of the job
+ */
+/**********************************************************************************/
+static inline long int computeWeightedTardiness(PfspInstance & pfspInstance, int job, long int completionTime){
+    const long int tardiness = completionTime - pfspInstance.getDueDates()[job];
+    return tardiness > 0 ? tardiness * pfspInstance.getPriorities()[job] : 0;
+}
+
+
+/**********************************************************************************/
+/**
+ * constructor, the state of the empty partial sequence
+ * @param nbrOfJobs the number of jobs of the instance
+ * @param nbrOfMachines the number of machines of the instance
+ */
+/**********************************************************************************/
+BranchWorker::BranchWorker(int nbrOfJobs, int nbrOfMachines):
+    sequence(nbrOfJobs + 1, 0),
+    completionTimes((nbrOfJobs + 1) * nbrOfMachines, 0),
+    objectiveScores(nbrOfJobs + 1, 0),
+    jobSets(nbrOfJobs + 1, 0),
+    children(nbrOfJobs + 1),
+    unscheduled(nbrOfJobs),
+    releaseTimes(nbrOfJobs),
+    machineStarts(nbrOfMachines),
+    minTails(nbrOfMachines),
+    slots(nbrOfJobs),
+    columnMins(nbrOfJobs),
+    costs(nbrOfJobs * nbrOfJobs),
+    swappedCompletionTimes(2 * nbrOfMachines),
+    openLowerBound(NO_CUTOFF){
+    for(vector<BranchChild> & nodeChildren : children) nodeChildren.reserve(nbrOfJobs);
+}
+
+
+/**********************************************************************************/
+/**
+ * constructor
+ * @param pfspInstance the instance to solve, with at most BB_MAX_JOBS jobs
+ * @param config the configuration with the time budget, the number of threads, the
+ *               memory budget of the dominance tables and the neighbourhoods of the
+ *               descent of the first schedule
+ */
+/**********************************************************************************/
+BranchAndBound::BranchAndBound(PfspInstance & pfspInstance, Configuration & config):
+    pfspInstance(pfspInstance),
+    config(config),
+    nbrOfJobs(pfspInstance.getNbrOfJobs()),
+    nbrOfMachines(pfspInstance.getNbrOfMachines()),
+    deadline(config.getTimeBudget(), getBudget(config, pfspInstance.getNbrOfJobs(), pfspInstance.getNbrOfMachines())),
+    processTimes((pfspInstance.getNbrOfJobs() + 1) * pfspInstance.getNbrOfMachines(), 0),
+    tails((pfspInstance.getNbrOfJobs() + 1) * pfspInstance.getNbrOfMachines(), 0),
+    jobsByProcessTime(pfspInstance.getNbrOfMachines() * pfspInstance.getNbrOfJobs()),
+    maxDominanceEntries(0),
+    stopped(false),
+    nbrOfNodes(0){
+    if(nbrOfJobs > BB_MAX_JOBS)
+        generateError("ERROR. file:branchandbound.cpp, method:BranchAndBound. branch and bound handles at most " +
+                      std::to_string(BB_MAX_JOBS) + " jobs");
+
+    for(int job = 1; job <= nbrOfJobs; ++job){
+        const ProcessTime* jobProcessTimes = pfspInstance.getJobProcessTimes(job);
+        for(int machine = nbrOfMachines - 1; machine >= 0; --machine){
+            processTimes[job * nbrOfMachines + machine] = jobProcessTimes[machine];
+            if(machine < nbrOfMachines - 1)
+                tails[job * nbrOfMachines + machine] = tails[job * nbrOfMachines + machine + 1] + jobProcessTimes[machine + 1];
+        }
+    }
+    for(int machine = 0; machine < nbrOfMachines; ++machine){
+        int* order = &jobsByProcessTime[machine * nbrOfJobs];
+        for(int job = 1; job <= nbrOfJobs; ++job) order[job - 1] = job;
+        std::stable_sort(order, order + nbrOfJobs, [&](int first, int second){
+            return processTimes[first * nbrOfMachines + machine] < processTimes[second * nbrOfMachines + machine];
+        });
+    }
+}
+BranchAndBound::~BranchAndBound(){
+}
+
+
+/**********************************************************************************/
+/**
+ * computes the completion times of a job appended to a partial sequence
+ * @param completionTimes the completion times of the partial sequence per machine
+ * @param job the job to append
+ * @param childCompletionTimes receives the completion times with the job appended
+ */
+/**********************************************************************************/
+void BranchAndBound::appendJob(const long int* completionTimes, int job, long int* childCompletionTimes){
+    const long int* jobProcessTimes = &processTimes[job * nbrOfMachines];
+    long int endTime = 0;
+    for(int machine = 0; machine < nbrOfMachines; ++machine){
+        endTime = std::max(endTime, completionTimes[machine]) + jobProcessTimes[machine];
+        childCompletionTimes[machine] = endTime;
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * appends a job to the partial sequence of a depth of a worker and stores the child
+ * on the next depth
+ * @param worker the worker
+ * @param depth the depth of the partial sequence
+ * @param job the job to append
+ * @return the weighted tardiness of the child
+ */
+/**********************************************************************************/
+long int BranchAndBound::enterChild(BranchWorker & worker, int depth, int job){
+    long int* childCompletionTimes = &worker.completionTimes[(depth + 1) * nbrOfMachines];
+    appendJob(&worker.completionTimes[depth * nbrOfMachines], job, childCompletionTimes);
+    worker.sequence[depth + 1] = job;
+    worker.jobSets[depth + 1] = worker.jobSets[depth] | (std::uint64_t(1) << job);
+    worker.objectiveScores[depth + 1] = worker.objectiveScores[depth] +
+                                        computeWeightedTardiness(pfspInstance, job, childCompletionTimes[nbrOfMachines - 1]);
+    return worker.objectiveScores[depth + 1];
+}
+
+
+/**********************************************************************************/
+/**
+ * computes a lower bound on the weighted tardiness of every completion of a partial
+ * sequence. The remaining jobs are assigned to the remaining positions, where a job
+ * on a position finishes no earlier than its release time (its completion time when
+ * it directly follows the partial sequence) and no earlier than the bound of the
+ * position. The bound of the i-th position is, over all machines, the earliest
+ * start of a remaining job on the machine plus the i shortest processing times of
+ * the remaining jobs on the machine plus the shortest processing time of a remaining
+ * job on the machines after it. The assignment is bounded by reducing its cost
+ * matrix by rows then columns and by columns then rows, the larger reduction counts.
+ * @param worker the worker, for its scratch memory
+ * @param completionTimes the completion times of the partial sequence per machine
+ * @param objectiveScore the weighted tardiness of the partial sequence
+ * @param jobSet the jobs of the partial sequence
+ * @return the lower bound
+ */
+/**********************************************************************************/
+long int BranchAndBound::computeLowerBound(BranchWorker & worker, const long int* completionTimes, long int objectiveScore,
+                                           std::uint64_t jobSet){
+    std::fill(worker.machineStarts.begin(), worker.machineStarts.end(), NO_CUTOFF);
+    std::fill(worker.minTails.begin(), worker.minTails.end(), NO_CUTOFF);
+    int nbrOfUnscheduled = 0;
+    for(int job = 1; job <= nbrOfJobs; ++job){
+        if((jobSet >> job) & 1) continue;
+        const long int* jobProcessTimes = &processTimes[job * nbrOfMachines];
+        const long int* jobTails = &tails[job * nbrOfMachines];
+        long int endTime = 0;
+        for(int machine = 0; machine < nbrOfMachines; ++machine){
+            const long int startTime = std::max(endTime, completionTimes[machine]);
+            worker.machineStarts[machine] = std::min(worker.machineStarts[machine], startTime);
+            worker.minTails[machine] = std::min(worker.minTails[machine], jobTails[machine]);
+            endTime = startTime + jobProcessTimes[machine];
+        }
+        worker.unscheduled[nbrOfUnscheduled] = job;
+        worker.releaseTimes[nbrOfUnscheduled] = endTime;
+        ++nbrOfUnscheduled;
+    }
+    if(nbrOfUnscheduled == 0) return objectiveScore;
+
+    // the bounds of the positions, nondecreasing because every machine term is
+    std::fill(worker.slots.begin(), worker.slots.begin() + nbrOfUnscheduled, 0);
+    for(int machine = 0; machine < nbrOfMachines; ++machine){
+        const int* order = &jobsByProcessTime[machine * nbrOfJobs];
+        long int endTime = worker.machineStarts[machine];
+        int slot = 0;
+        for(int rank = 0; rank < nbrOfJobs && slot < nbrOfUnscheduled; ++rank){
+            const int job = order[rank];
+            if((jobSet >> job) & 1) continue;
+            endTime += processTimes[job * nbrOfMachines + machine];
+            worker.slots[slot] = std::max(worker.slots[slot], endTime + worker.minTails[machine]);
+            ++slot;
+        }
+    }
+
+    // the cost matrix, every row is nondecreasing so its minimum is its first column
+    long int* costs = worker.costs.data();
+    long int rowsFirst = 0;
+    std::fill(worker.columnMins.begin(), worker.columnMins.begin() + nbrOfUnscheduled, NO_CUTOFF);
+    for(int j = 0; j < nbrOfUnscheduled; ++j){
+        const int job = worker.unscheduled[j];
+        long int* row = &costs[j * nbrOfUnscheduled];
+        for(int slot = 0; slot < nbrOfUnscheduled; ++slot){
+            row[slot] = computeWeightedTardiness(pfspInstance, job, std::max(worker.slots[slot], worker.releaseTimes[j]));
+            worker.columnMins[slot] = std::min(worker.columnMins[slot], row[slot] - row[0]);
+        }
+        rowsFirst += row[0];
+    }
+    for(int slot = 0; slot < nbrOfUnscheduled; ++slot) rowsFirst += worker.columnMins[slot];
+
+    long int columnsFirst = 0;
+    std::fill(worker.columnMins.begin(), worker.columnMins.begin() + nbrOfUnscheduled, NO_CUTOFF);
+    for(int j = 0; j < nbrOfUnscheduled; ++j)
+        for(int slot = 0; slot < nbrOfUnscheduled; ++slot)
+            worker.columnMins[slot] = std::min(worker.columnMins[slot], costs[j * nbrOfUnscheduled + slot]);
+    for(int slot = 0; slot < nbrOfUnscheduled; ++slot) columnsFirst += worker.columnMins[slot];
+    for(int j = 0; j < nbrOfUnscheduled; ++j){
+        long int rowMin = NO_CUTOFF;
+        for(int slot = 0; slot < nbrOfUnscheduled; ++slot)
+            rowMin = std::min(rowMin, costs[j * nbrOfUnscheduled + slot] - worker.columnMins[slot]);
+        columnsFirst += rowMin;
+    }
+    return objectiveScore + std::max(rowsFirst, columnsFirst);
+}
+
+
+/**********************************************************************************/
+/**
+ * checks if the child of a partial sequence is dominated by the same child with its
+ * last two jobs swapped: the swapped child finishes no later on every machine with
+ * no more weighted tardiness, and it is better somewhere or, when both are equal,
+ * the swapped child is the one that is kept
+ * @param worker the worker, the child is on depth + 1
+ * @param depth the depth of the partial sequence, at least 1
+ * @param job the last job of the child
+ * @param completionTimes the completion times of the child per machine
+ * @param objectiveScore the weighted tardiness of the child
+ * @return true if the child is dominated
+ */
+/**********************************************************************************/
+bool BranchAndBound::isSwapDominated(BranchWorker & worker, int depth, int job, const long int* completionTimes, long int objectiveScore){
+    const int lastJob = worker.sequence[depth];
+    long int* firstCompletionTimes = &worker.swappedCompletionTimes[0];
+    long int* secondCompletionTimes = &worker.swappedCompletionTimes[nbrOfMachines];
+    appendJob(&worker.completionTimes[(depth - 1) * nbrOfMachines], job, firstCompletionTimes);
+    appendJob(firstCompletionTimes, lastJob, secondCompletionTimes);
+    const long int swappedObjectiveScore = worker.objectiveScores[depth - 1] +
+                                           computeWeightedTardiness(pfspInstance, job, firstCompletionTimes[nbrOfMachines - 1]) +
+                                           computeWeightedTardiness(pfspInstance, lastJob, secondCompletionTimes[nbrOfMachines - 1]);
+    if(swappedObjectiveScore > objectiveScore) return false;
+    bool better = swappedObjectiveScore < objectiveScore;
+    for(int machine = 0; machine < nbrOfMachines; ++machine){
+        if(secondCompletionTimes[machine] > completionTimes[machine]) return false;
+        if(secondCompletionTimes[machine] < completionTimes[machine]) better = true;
+    }
+    return better || job < lastJob;
+}
+
+
+/**********************************************************************************/
+/**
+ * checks if a partial sequence is dominated by a partial sequence of the same jobs
+ * in the dominance table of the worker, that finishes no later on every machine with
+ * no more weighted tardiness. A partial sequence that is not dominated enters the
+ * table as long as the table has room.
+ * @param worker the worker
+ * @param completionTimes the completion times of the partial sequence per machine
+ * @param objectiveScore the weighted tardiness of the partial sequence
+ * @param jobSet the jobs of the partial sequence
+ * @return true if the partial sequence is dominated
+ */
+/**********************************************************************************/
+bool BranchAndBound::isDominated(BranchWorker & worker, const long int* completionTimes, long int objectiveScore, std::uint64_t jobSet){
+    const int width = nbrOfMachines + 1;
+    auto found = worker.dominanceTable.find(jobSet);
+    if(found != worker.dominanceTable.end()){
+        const vector<long int> & entries = found->second;
+        for(int entry = 0; entry < entries.size(); entry += width){
+            if(entries[entry] > objectiveScore) continue;
+            int machine = 0;
+            while(machine < nbrOfMachines && entries[entry + 1 + machine] <= completionTimes[machine]) ++machine;
+            if(machine == nbrOfMachines) return true;
+        }
+    }
+    if(worker.dominanceEntries >= maxDominanceEntries) return false;
+    vector<long int> & entries = found != worker.dominanceTable.end() ? found->second : worker.dominanceTable[jobSet];
+    entries.push_back(objectiveScore);
+    entries.insert(entries.end(), completionTimes, completionTimes + nbrOfMachines);
+    ++worker.dominanceEntries;
+    return false;
+}
+
+
+/**********************************************************************************/
+/**
+ * counts a node of a worker and, every DEADLINE_CHECK_INTERVAL nodes, adds the nodes
+ * to the shared count and checks the deadline: a budget of evaluations counts the
+ * nodes of all workers, a budget of CPU time counts the CPU time of all workers,
+ * so that it also runs out while worker 0 (the thread that started the deadline)
+ * waits for the others
+ * @param worker the worker
+ * @param index the index of the worker
+ * @return true if the search must stop
+ */
+/**********************************************************************************/
+bool BranchAndBound::countNode(BranchWorker & worker, int index){
+    ++worker.nbrOfNodes;
+    if(++worker.nbrOfUncountedNodes < DEADLINE_CHECK_INTERVAL) return stopped.load(std::memory_order_relaxed);
+    const long int nodes = nbrOfNodes.fetch_add(worker.nbrOfUncountedNodes) + worker.nbrOfUncountedNodes;
+    worker.nbrOfUncountedNodes = 0;
+    bool expired;
+    if(deadline.isEvaluationBudget()) expired = nodes >= deadline.getBudget();
+    else{
+        if(index > 0) deadline.addHelperCpuTime(worker.cpuTime);
+        expired = index == 0 ? deadline.checkNow() : deadline.isTimeUp();
+    }
+    if(expired) stopped.store(true);
+    return stopped.load(std::memory_order_relaxed);
+}
+
+
+/**********************************************************************************/
+/**
+ * explores the subtree of the partial sequence of a depth of a worker depth first.
+ * The children are bounded and checked for dominance, then explored in order of
+ * their lower bounds as long as that is below the best schedule. A complete
+ * schedule that beats the best schedule is published. When the search stops, the
+ * lowest lower bound of the subtrees left unexplored is kept by the worker.
+ * @param worker the worker
+ * @param index the index of the worker
+ * @param depth the depth of the partial sequence
+ * @param lowerBound the lower bound of the partial sequence
+ * @param rootDepth the depth of the roots to collect
+ * @param roots collects the partial sequences of rootDepth instead of exploring
+ *              them, or nullptr
+ */
+/**********************************************************************************/
+void BranchAndBound::explore(BranchWorker & worker, int index, int depth, long int lowerBound, int rootDepth, vector<BranchRoot> * roots){
+    if(roots && depth == rootDepth){
+        roots->push_back({rootDepth > 0 ? worker.sequence[1] : 0, rootDepth > 1 ? worker.sequence[2] : 0, lowerBound});
+        return;
+    }
+
+    const int childDepth = depth + 1;
+    const long int* childCompletionTimes = &worker.completionTimes[childDepth * nbrOfMachines];
+    vector<BranchChild> & children = worker.children[depth];
+    children.clear();
+    for(int job = 1; job <= nbrOfJobs; ++job){
+        if((worker.jobSets[depth] >> job) & 1) continue;
+        if(countNode(worker, index)){
+            worker.openLowerBound = std::min(worker.openLowerBound, lowerBound);
+            return;
+        }
+        const long int childObjectiveScore = enterChild(worker, depth, job);
+        if(childDepth == nbrOfJobs){
+            if(childObjectiveScore < incumbent.getObjectiveScore()) incumbent.publish(childObjectiveScore, worker.sequence, index);
+            continue;
+        }
+        if((depth > 0 && isSwapDominated(worker, depth, job, childCompletionTimes, childObjectiveScore)) ||
+           isDominated(worker, childCompletionTimes, childObjectiveScore, worker.jobSets[childDepth])){
+            ++worker.nbrOfDominated;
+            continue;
+        }
+        const long int childLowerBound = computeLowerBound(worker, childCompletionTimes, childObjectiveScore, worker.jobSets[childDepth]);
+        if(childLowerBound >= incumbent.getObjectiveScore()){
+            ++worker.nbrOfPruned;
+            continue;
+        }
+        children.push_back({job, childLowerBound});
+    }
+    std::sort(children.begin(), children.end(), [](const BranchChild & first, const BranchChild & second){
+        return first.lowerBound < second.lowerBound || (first.lowerBound == second.lowerBound && first.job < second.job);
+    });
+
+    for(int child = 0; child < children.size(); ++child){
+        if(stopped.load(std::memory_order_relaxed)){
+            worker.openLowerBound = std::min(worker.openLowerBound, children[child].lowerBound);
+            return;
+        }
+        // the children are in order of their lower bounds, so the rest can not beat it either
+        if(children[child].lowerBound >= incumbent.getObjectiveScore()){
+            worker.nbrOfPruned += children.size() - child;
+            return;
+        }
+        enterChild(worker, depth, children[child].job);
+        explore(worker, index, childDepth, children[child].lowerBound, rootDepth, roots);
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * solves the instance. The first schedule is the SRZ heuristic improved by a first
+ * improvement descent of at most BB_LOCAL_SEARCH_EVALUATIONS times the squared
+ * number of jobs evaluations. The partial sequences of BB_ROOT_DEPTH jobs are
+ * collected on the calling thread and explored in order of their lower bounds by a
+ * pool of as many threads as the configuration sets, every thread with its own
+ * dominance table in an equal share of the memory budget. The search stops when the
+ * deadline expires, where a budget of evaluations counts the nodes.
+ * @return a solverResult with the best schedule, its proven lower bound (equal to
+ *         its score when it is optimal), the nodes of the search as neighbours
+ *         tested, the cut off nodes as neighbours pruned and the nodes cut off by a
+ *         dominance table as retrievals from memory
+ */
+/**********************************************************************************/
+solverResult BranchAndBound::solve(){
+    auto start = std::chrono::high_resolution_clock::now();
+    deadline.start();
+    const long int maxDuration = deadline.isEvaluationBudget() ? 0 : std::lround(deadline.getBudget());
+
+    // the first schedule
+    vector<MoveGenerator> neighbourhoodSequence;
+    for(Neigbourhood type : config.getNeighbourhoodVector()) neighbourhoodSequence.push_back(MoveGenerator(type, nbrOfJobs));
+    DescentWorker descentWorker(pfspInstance);
+    descentWorker.solution = getSRZHeuristicInitSolution(pfspInstance, config.getChooseRandomWhenEqual());
+    long int evaluations = 0;
+    long int prunedEvaluations = 0;
+    const long int initObjectiveScore = descendWithFirstImprovement(descentWorker, neighbourhoodSequence,
+                                                                    pfspInstance.computeSolutionTardiness(descentWorker.solution),
+                                                                    static_cast<long int>(BB_LOCAL_SEARCH_EVALUATIONS) * nbrOfJobs * nbrOfJobs,
+                                                                    &deadline, evaluations, prunedEvaluations);
+    incumbent.publish(initObjectiveScore, descentWorker.solution, 0);
+    nbrOfNodes.store(evaluations);
+
+    const int nbrOfThreads = std::max(1, config.getNbrOfThreads());
+    std::unique_ptr<ThreadPool> threadPool;
+    if(nbrOfThreads > 1) threadPool.reset(new ThreadPool(nbrOfThreads));
+    maxDominanceEntries = config.getMemoryBudget() * 1024 * 1024 / nbrOfThreads / ((nbrOfMachines + 1) * sizeof(long int));
+    workers.reserve(nbrOfThreads);
+    for(int worker = 0; worker < nbrOfThreads; ++worker) workers.emplace_back(nbrOfJobs, nbrOfMachines);
+
+    // the roots of the subtrees, in order of their lower bounds
+    const int rootDepth = std::min(BB_ROOT_DEPTH, nbrOfJobs - 1);
+    vector<BranchRoot> roots;
+    const long int rootLowerBound = computeLowerBound(workers[0], workers[0].completionTimes.data(), 0, 0);
+    if(rootLowerBound < incumbent.getObjectiveScore()) explore(workers[0], 0, 0, rootLowerBound, rootDepth, &roots);
+    std::stable_sort(roots.begin(), roots.end(), [](const BranchRoot & first, const BranchRoot & second){
+        return first.lowerBound < second.lowerBound;
+    });
+
+    const std::function<void(int, int)> exploreRoot = [&](int task, int index){
+        BranchWorker & worker = workers[index];
+        const BranchRoot & root = roots[task];
+        if(stopped.load(std::memory_order_relaxed)){
+            worker.openLowerBound = std::min(worker.openLowerBound, root.lowerBound);
+            return;
+        }
+        if(root.lowerBound >= incumbent.getObjectiveScore()){
+            ++worker.nbrOfPruned;
+            return;
+        }
+        if(rootDepth > 0) enterChild(worker, 0, root.first);
+        if(rootDepth > 1) enterChild(worker, 1, root.second);
+        explore(worker, index, rootDepth, root.lowerBound, rootDepth, nullptr);
+    };
+    if(threadPool) threadPool->run(roots.size(), exploreRoot);
+    else for(int task = 0; task < roots.size(); ++task) exploreRoot(task, 0);
+
+    // the optimum lies between the lowest bound left open and the best schedule
+    long int lowerBound = incumbent.getObjectiveScore();
+    long int nodes = nbrOfNodes.load();
+    long int prunedNodes = prunedEvaluations;
+    long int dominatedNodes = 0;
+    long int dominanceEntries = 0;
+    for(BranchWorker & worker : workers){
+        lowerBound = std::min(lowerBound, worker.openLowerBound);
+        nodes += worker.nbrOfUncountedNodes;
+        prunedNodes += worker.nbrOfPruned + worker.nbrOfDominated;
+        dominatedNodes += worker.nbrOfDominated;
+        dominanceEntries += worker.dominanceEntries;
+    }
+
+    auto stop = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(stop - start);
+    solverResult result = {
+        .sequence = incumbent.getSolution(),
+        .objectiveScore = incumbent.getObjectiveScore(),
+        .duration = duration.count(),
+        .durationLimit = maxDuration,
+        .overshoot = static_cast<float>(deadline.getOvershoot()),
+        .evaluationsPerSecond = static_cast<float>(nodes / std::chrono::duration<double>(stop - start).count()),
+        .neighboursTested = nodes,
+        .neighbourhoodsTested = static_cast<long int>(roots.size()),
+        .neighboursPruned = prunedNodes,
+        .initAnnealingTemp = 0,
+        .finalAnnealingTemp = 0,
+        .annealingSteps = 0,
+        .annealingReheats = 0,
+        .memorySize = dominanceEntries,
+        .memoryRetrievals = dominatedNodes,
+        .memoryMisses = 0,
+        .memoryEvictions = 0,
+        .memoryBytes = dominanceEntries * (nbrOfMachines + 1) * static_cast<long int>(sizeof(long int)),
+        .memoryFalsePositiveRate = 0,
+        .memoryDecisions = "",
+        .migrantsReceived = 0,
+        .migrantsAdopted = 0,
+        .islandStatistics = "",
+        .relinkingStatistics = "",
+        .lowerBound = lowerBound
+        };
+    return result;
+}
@@ -0,0 +1,114 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* headerfile for branchandbound.cpp
+/********************************************************************************/
+#ifndef _BRANCHANDBOUND_H_
+#define _BRANCHANDBOUND_H_
+
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+
+#include "pfspinstance.h"
+#include "configuration.h"
+#include "deadline.h"
+#include "sharedincumbent.h"
+#include "solver.h"
+
+using std::vector;
+
+
+// a child of a node of the search tree: the job that is appended to the partial
+// sequence of the node and the lower bound of the child
+struct BranchChild{
+    int job;
+    long int lowerBound;
+};
+
+
+// a subtree that one task of the thread pool explores: the first (up to two) jobs of
+// its partial sequence and its lower bound
+struct BranchRoot{
+    int first;
+    int second;
+    long int lowerBound;
+};
+
+
+// the state with which one thread explores subtrees. Per depth of the tree it holds
+// the partial sequence, its completion times on every machine, its weighted tardiness,
+// its set of jobs and its children. The dominance table holds, per set of jobs, the
+// weighted tardiness and completion times of the partial sequences seen before.
+struct BranchWorker{
+    vector<int> sequence;
+    vector<long int> completionTimes;
+    vector<long int> objectiveScores;
+    vector<std::uint64_t> jobSets;
+    vector<vector<BranchChild>> children;
+    std::unordered_map<std::uint64_t, vector<long int>> dominanceTable;
+    long int dominanceEntries = 0;
+
+    // scratch of the lower bound and of the dominance of swapped jobs
+    vector<int> unscheduled;
+    vector<long int> releaseTimes;
+    vector<long int> machineStarts;
+    vector<long int> minTails;
+    vector<long int> slots;
+    vector<long int> columnMins;
+    vector<long int> costs;
+    vector<long int> swappedCompletionTimes;
+
+    long int nbrOfNodes = 0;
+    long int nbrOfUncountedNodes = 0;
+
+    // the CPU time of the thread of the worker that was added to a budget of CPU time
+    double cpuTime = 0;
+    long int nbrOfPruned = 0;
+    long int nbrOfDominated = 0;
+
+    // the lowest lower bound of the subtrees that were left unexplored when the
+    // search stopped
+    long int openLowerBound;
+
+    BranchWorker(int nbrOfJobs, int nbrOfMachines);
+};
+
+
+// class definition
+class BranchAndBound{
+    private:
+        PfspInstance & pfspInstance;
+        Configuration & config;
+        int nbrOfJobs;
+        int nbrOfMachines;
+        Deadline deadline;
+
+        // processing times per job and machine, the processing times of a job on the
+        // machines after a machine, and per machine the jobs in order of processing time
+        vector<long int> processTimes;
+        vector<long int> tails;
+        vector<int> jobsByProcessTime;
+        long int maxDominanceEntries;
+
+        SharedIncumbent incumbent;
+        std::atomic<bool> stopped;
+        std::atomic<long int> nbrOfNodes;
+        vector<BranchWorker> workers;
+
+        long int enterChild(BranchWorker & worker, int depth, int job);
+        void appendJob(const long int* completionTimes, int job, long int* childCompletionTimes);
+        long int computeLowerBound(BranchWorker & worker, const long int* completionTimes, long int objectiveScore, std::uint64_t jobSet);
+        bool isSwapDominated(BranchWorker & worker, int depth, int job, const long int* completionTimes, long int objectiveScore);
+        bool isDominated(BranchWorker & worker, const long int* completionTimes, long int objectiveScore, std::uint64_t jobSet);
+        bool countNode(BranchWorker & worker, int index);
+        void explore(BranchWorker & worker, int index, int depth, long int lowerBound, int rootDepth, vector<BranchRoot> * roots);
+
+    public:
+        BranchAndBound(PfspInstance & pfspInstance, Configuration & config);
+        ~BranchAndBound();
+
+        solverResult solve();
+};
+
+#endif
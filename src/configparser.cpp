@@ -43,13 +43,37 @@ Configuration parseToConfiguration(int argc,char *argv[]){
     string tempAnnealingLimit = DEFAULT_ANNEALING_LIMIT;
     string tempPertubationValue = DEFAULT_PERTUBATION_VALUE;
     string tempseed = "N";
+    string tempMemoryBudget = std::to_string(DEFAULT_MEMORY_BUDGET);
+    string tempFalsePositiveRate = std::to_string(DEFAULT_FALSE_POSITIVE_RATE);
+    string tempCooling = DEFAULT_COOLING;
+    string tempTimeBudget = DEFAULT_TIME_BUDGET;
+    string tempTimeLimit = std::to_string(DEFAULT_TIME_LIMIT);
+    string tempDestructionSize = std::to_string(DEFAULT_DESTRUCTION_SIZE);
+    string tempTabuTenure = std::to_string(DEFAULT_TABU_TENURE);
+    string tempPopulationSize = std::to_string(DEFAULT_POPULATION_SIZE);
+    string tempCrossover = DEFAULT_CROSSOVER;
+    string tempIlsAcceptance = DEFAULT_ILS_ACCEPTANCE;
+    string tempNbrOfChains = std::to_string(DEFAULT_NBR_OF_CHAINS);
+    string tempMigrationInterval = std::to_string(DEFAULT_MIGRATION_INTERVAL);
+    string tempMigrantAdoption = DEFAULT_MIGRANT_ADOPTION;
+    string tempIslandMix = DEFAULT_ISLAND_MIX;
+    string tempNbrOfThreads = std::to_string(DEFAULT_NBR_OF_THREADS);
     
     // define final variables
     InitSolution initSolution;
     Neigbourhood neighbourhood;
     Pivotrules pivotRule;
     SolverMemory solverMemory;
-    int annealingLimit, pertubationValue, seed;
+    Cooling cooling;
+    IlsAcceptance ilsAcceptance;
+    MigrantAdoption migrantAdoption;
+    IslandMix islandMix;
+    Crossover crossover;
+    TimeBudget timeBudget;
+    float timeLimit;
+    int annealingLimit, pertubationValue, destructionSize, tabuTenure, populationSize, nbrOfChains, migrationInterval, nbrOfThreads, seed;
+    long int memoryBudget;
+    float falsePositiveRate;
     float annealingDecay;
 
     // define internal flags used within the function
@@ -92,6 +116,36 @@ Configuration parseToConfiguration(int argc,char *argv[]){
                 case 'R': tempPertubationValue = argv[i+1]; break;
                 case 's':
                 case 'S': tempseed = argv[i+1];seedIsGiven = true; break;   
+                case 'b':
+                case 'B': tempMemoryBudget = argv[i+1]; break;
+                case 'f':
+                case 'F': tempFalsePositiveRate = argv[i+1]; break;
+                case 'c':
+                case 'C': tempCooling = argv[i+1]; break;
+                case 't':
+                case 'T': tempTimeLimit = argv[i+1]; break;
+                case 'u':
+                case 'U': tempTimeBudget = argv[i+1]; break;
+                case 'g':
+                case 'G': tempDestructionSize = argv[i+1]; break;
+                case 'e':
+                case 'E': tempTabuTenure = argv[i+1]; break;
+                case 'z':
+                case 'Z': tempPopulationSize = argv[i+1]; break;
+                case 'y':
+                case 'Y': tempCrossover = argv[i+1]; break;
+                case 'a':
+                case 'A': tempIlsAcceptance = argv[i+1]; break;
+                case 'k':
+                case 'K': tempNbrOfChains = argv[i+1]; break;
+                case 'w':
+                case 'W': tempMigrationInterval = argv[i+1]; break;
+                case 'x':
+                case 'X': tempMigrantAdoption = argv[i+1]; break;
+                case 'o':
+                case 'O': tempIslandMix = argv[i+1]; break;
+                case 'j':
+                case 'J': tempNbrOfThreads = argv[i+1]; break;
                 default: correctInput = 0;
                 }
         }   
@@ -132,6 +186,11 @@ Configuration parseToConfiguration(int argc,char *argv[]){
         if(tempPivotingRule.compare("FIRST")==0) pivotRule = FIRST;
         else if (tempPivotingRule.compare("BEST")==0) pivotRule = BEST;
         else if (tempPivotingRule.compare("ANNEAL")==0) pivotRule = ANNEAL;
+        else if (tempPivotingRule.compare("SA")==0) pivotRule = SA;
+        else if (tempPivotingRule.compare("IG")==0) pivotRule = IG;
+        else if (tempPivotingRule.compare("TS")==0) pivotRule = TS;
+        else if (tempPivotingRule.compare("GA")==0) pivotRule = GA;
+        else if (tempPivotingRule.compare("BB")==0) pivotRule = BB;
         else correctInput = false;
 
         // check if solvermemory is a valid choice, 
@@ -139,7 +198,58 @@ Configuration parseToConfiguration(int argc,char *argv[]){
         if(tempSolverMemory.compare("NONE")==0) solverMemory = NONE;
         else if (tempSolverMemory.compare("HASH")==0) solverMemory = HASH;
         else if (tempSolverMemory.compare("MAP")==0) solverMemory = MAP;
+        else if (tempSolverMemory.compare("FLAT")==0) solverMemory = FLAT;
+        else if (tempSolverMemory.compare("BLOOM")==0) solverMemory = BLOOM;
+        else if (tempSolverMemory.compare("ADAPTIVE")==0) solverMemory = ADAPTIVE;
         else correctInput = false;
+
+        // check if cooling is a valid choice, 
+        // if yes set config variable, if no set correctinput flag to false
+        if(tempCooling.compare("FIXED")==0) cooling = FIXED;
+        else if (tempCooling.compare("TIMED")==0) cooling = TIMED;
+        else correctInput = false;
+
+        // check if the acceptance of the iterated local search is a valid choice, 
+        // if yes set config variable, if no set correctinput flag to false
+        if(tempIlsAcceptance.compare("BETTER")==0) ilsAcceptance = BETTER;
+        else if (tempIlsAcceptance.compare("WALK")==0) ilsAcceptance = WALK;
+        else if (tempIlsAcceptance.compare("RESTART")==0) ilsAcceptance = RESTART;
+        else correctInput = false;
+
+        // check if the adoption of migrants is a valid choice, 
+        // if yes set config variable, if no set correctinput flag to false
+        if(tempMigrantAdoption.compare("IMPROVING")==0) migrantAdoption = IMPROVING;
+        else if (tempMigrantAdoption.compare("ALWAYS")==0) migrantAdoption = ALWAYS;
+        else correctInput = false;
+
+        // check if the search of the islands is a valid choice, 
+        // if yes set config variable, if no set correctinput flag to false
+        if(tempIslandMix.compare("SAME")==0) islandMix = SAME;
+        else if (tempIslandMix.compare("MIXED")==0) islandMix = MIXED;
+        else correctInput = false;
+
+        // check if the crossover is a valid choice, 
+        // if yes set config variable, if no set correctinput flag to false
+        if(tempCrossover.compare("OX")==0) crossover = OX;
+        else if (tempCrossover.compare("PMX")==0) crossover = PMX;
+        else if (tempCrossover.compare("SJOX")==0) crossover = SJOX;
+        else correctInput = false;
+
+        // check if the time budget is a valid choice, 
+        // if yes set config variable, if no set correctinput flag to false
+        if(tempTimeBudget.compare("WALL")==0) timeBudget = WALL;
+        else if (tempTimeBudget.compare("CPU")==0) timeBudget = CPU;
+        else if (tempTimeBudget.compare("NM")==0) timeBudget = NM;
+        else if (tempTimeBudget.compare("EVALS")==0) timeBudget = EVALS;
+        else if (tempTimeBudget.compare("EVALSNM")==0) timeBudget = EVALSNM;
+        else correctInput = false;
+
+        //check if tempTimeLimit is a positive float or 0, a budget of evaluations has no default
+        // if yes set config variable, if no set correctinput flag to false
+        if(isFloatNumber(tempTimeLimit)) timeLimit = std::stof(tempTimeLimit);
+        else correctInput =0;
+        if(correctInput && timeLimit < 0) correctInput =0;
+        if(correctInput && (timeBudget == EVALS || timeBudget == EVALSNM) && timeLimit == 0) correctInput =0;
         
         //check if tempAnnealingDecay is a float between 0 and 1
         // if yes set config variable, if no set correctinput flag to false
@@ -152,11 +262,64 @@ Configuration parseToConfiguration(int argc,char *argv[]){
         if(isStringNumber(tempAnnealingLimit)) annealingLimit = std::stoi(tempAnnealingLimit);
         else correctInput =0;
 
+        //check if tempMemoryBudget is a positive integer
+        // if yes set config variable, if no set correctinput flag to false
+        if(isStringNumber(tempMemoryBudget)) memoryBudget = std::stol(tempMemoryBudget);
+        else correctInput =0;
+        if(correctInput && memoryBudget <= 0) correctInput =0;
+
+        //check if tempFalsePositiveRate is a float between 0 and 1
+        // if yes set config variable, if no set correctinput flag to false
+        if(isFloatNumber(tempFalsePositiveRate)) falsePositiveRate = std::stof(tempFalsePositiveRate);
+        else correctInput =0;
+        if(correctInput && (falsePositiveRate <= 0 || falsePositiveRate >= 1)) correctInput =0;
+
+        //check that the BLOOM memory, which skips every revisit, is not combined with 
+        //ANNEAL, which may accept a neighbour it rejected before
+        // if it is, set correctinput flag to false
+        if(correctInput && solverMemory == BLOOM && pivotRule == ANNEAL) correctInput =0;
+
         //check if tempPertubationValue is an integer
         // if yes set config variable, if no set correctinput flag to false
         if(isStringNumber(tempPertubationValue)) pertubationValue = std::stoi(tempPertubationValue);
         else correctInput =0;
 
+        //check if tempDestructionSize is a positive integer
+        // if yes set config variable, if no set correctinput flag to false
+        if(isStringNumber(tempDestructionSize)) destructionSize = std::stoi(tempDestructionSize);
+        else correctInput =0;
+        if(correctInput && destructionSize <= 0) correctInput =0;
+
+        //check if tempTabuTenure is a positive integer or 0
+        // if yes set config variable, if no set correctinput flag to false
+        if(isStringNumber(tempTabuTenure)) tabuTenure = std::stoi(tempTabuTenure);
+        else correctInput =0;
+        if(correctInput && tabuTenure < 0) correctInput =0;
+
+        //check if tempPopulationSize is an integer of at least 2
+        // if yes set config variable, if no set correctinput flag to false
+        if(isStringNumber(tempPopulationSize)) populationSize = std::stoi(tempPopulationSize);
+        else correctInput =0;
+        if(correctInput && populationSize < 2) correctInput =0;
+
+        //check if tempNbrOfChains is a positive integer
+        // if yes set config variable, if no set correctinput flag to false
+        if(isStringNumber(tempNbrOfChains)) nbrOfChains = std::stoi(tempNbrOfChains);
+        else correctInput =0;
+        if(correctInput && nbrOfChains <= 0) correctInput =0;
+
+        //check if tempMigrationInterval is a positive integer or 0
+        // if yes set config variable, if no set correctinput flag to false
+        if(isStringNumber(tempMigrationInterval)) migrationInterval = std::stoi(tempMigrationInterval);
+        else correctInput =0;
+        if(correctInput && migrationInterval < 0) correctInput =0;
+
+        //check if tempNbrOfThreads is a positive integer
+        // if yes set config variable, if no set correctinput flag to false
+        if(isStringNumber(tempNbrOfThreads)) nbrOfThreads = std::stoi(tempNbrOfThreads);
+        else correctInput =0;
+        if(correctInput && nbrOfThreads <= 0) correctInput =0;
+
         // if seed is given, check if seed is number, if yes, convert and set config variable, 
         // if no set correctinput flag to false
         // if seed is not given, choose random seed
@@ -196,5 +359,19 @@ Configuration parseToConfiguration(int argc,char *argv[]){
         pertubationValue,
         true,
         seed);
+    configuration.setMemoryBudget(memoryBudget);
+    configuration.setFalsePositiveRate(falsePositiveRate);
+    configuration.setCooling(cooling);
+    configuration.setTimeLimit(timeBudget, timeLimit);
+    configuration.setDestructionSize(destructionSize);
+    configuration.setTabuTenure(tabuTenure);
+    configuration.setPopulationSize(populationSize);
+    configuration.setCrossover(crossover);
+    configuration.setIlsAcceptance(ilsAcceptance);
+    configuration.setNbrOfChains(nbrOfChains);
+    configuration.setMigrationInterval(migrationInterval);
+    configuration.setMigrantAdoption(migrantAdoption);
+    configuration.setIslandMix(islandMix);
+    configuration.setNbrOfThreads(nbrOfThreads);
     return configuration;
 }
\ No newline at end of file
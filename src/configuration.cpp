@@ -7,6 +7,7 @@
 #include <string>
 #include <vector>
 #include "configuration.h"
+#include "constants.h"
 
 using std::string, std::vector;
 
@@ -50,6 +51,21 @@ Configuration::Configuration(
     this->pertubationValue = pertubationValue;
     this->chooseRandomWhenEqual = chooseRandomWhenEqual;
     this->seed = seed;
+    this->memoryBudget = DEFAULT_MEMORY_BUDGET;
+    this->falsePositiveRate = DEFAULT_FALSE_POSITIVE_RATE;
+    this->cooling = FIXED;
+    this->timeBudget = WALL;
+    this->timeLimit = DEFAULT_TIME_LIMIT;
+    this->destructionSize = DEFAULT_DESTRUCTION_SIZE;
+    this->tabuTenure = DEFAULT_TABU_TENURE;
+    this->populationSize = DEFAULT_POPULATION_SIZE;
+    this->crossover = SJOX;
+    this->ilsAcceptance = BETTER;
+    this->nbrOfChains = DEFAULT_NBR_OF_CHAINS;
+    this->migrationInterval = DEFAULT_MIGRATION_INTERVAL;
+    this->migrantAdoption = IMPROVING;
+    this->islandMix = SAME;
+    this->nbrOfThreads = DEFAULT_NBR_OF_THREADS;
 };
 
 
@@ -129,6 +145,17 @@ Pivotrules Configuration::getPivotingRule(){
 };
 
 
+/**********************************************************************************/
+/**
+ * function to set the pivoting rule
+ * @param pivotingRule the new pivoting rule
+ */
+/**********************************************************************************/
+void Configuration::setPivotingRule(Pivotrules pivotingRule){
+    this->pivotingRule = pivotingRule;
+};
+
+
 /**********************************************************************************/
 /**
  * function to obtain the solver memory setting as set in the configuration
@@ -210,6 +237,343 @@ void Configuration::setSeed(int seed){
 };
 
 
+/**********************************************************************************/
+/**
+ * function to obtain the byte budget of the FLAT, BLOOM and ADAPTIVE solver memory
+ * @return the memory budget in megabytes as set in the configuration
+ */
+/**********************************************************************************/
+long int Configuration::getMemoryBudget(){
+    return this->memoryBudget;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to set the byte budget of the FLAT, BLOOM and ADAPTIVE solver memory
+ * @param memoryBudget the new memory budget in megabytes
+ */
+/**********************************************************************************/
+void Configuration::setMemoryBudget(long int memoryBudget){
+    this->memoryBudget = memoryBudget;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to obtain the false positive rate the BLOOM solver memory may reach
+ * @return the false positive rate as set in the configuration
+ */
+/**********************************************************************************/
+float Configuration::getFalsePositiveRate(){
+    return this->falsePositiveRate;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to set the false positive rate the BLOOM solver memory may reach
+ * @param falsePositiveRate the new false positive rate, between 0 and 1
+ */
+/**********************************************************************************/
+void Configuration::setFalsePositiveRate(float falsePositiveRate){
+    this->falsePositiveRate = falsePositiveRate;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to obtain the cooling schedule of simulated annealing
+ * @return the cooling schedule as set in the configuration
+ */
+/**********************************************************************************/
+Cooling Configuration::getCooling(){
+    return this->cooling;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to set the cooling schedule of simulated annealing
+ * @param cooling FIXED to decay with the annealing decay, TIMED to decay so that
+ *                the minimal temperature is reached at the max duration
+ */
+/**********************************************************************************/
+void Configuration::setCooling(Cooling cooling){
+    this->cooling = cooling;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to obtain how the time limit of the solver is measured
+ * @return the time budget type as set in the configuration
+ */
+/**********************************************************************************/
+TimeBudget Configuration::getTimeBudget(){
+    return this->timeBudget;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to obtain the time limit of the solver
+ * @return the time limit as set in the configuration, 0 for the default limit
+ */
+/**********************************************************************************/
+float Configuration::getTimeLimit(){
+    return this->timeLimit;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to set the time limit of the solver
+ * @param timeBudget WALL for milliseconds of wall time, CPU for milliseconds of CPU
+ *                   time, NM for milliseconds of wall time per job and machine,
+ *                   EVALS for evaluated neighbours, EVALSNM for evaluated neighbours
+ *                   per job and machine
+ * @param timeLimit the time limit, 0 for the default limit of the instance (only
+ *                  for the time budgets)
+ */
+/**********************************************************************************/
+void Configuration::setTimeLimit(TimeBudget timeBudget, float timeLimit){
+    this->timeBudget = timeBudget;
+    this->timeLimit = timeLimit;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to obtain the number of jobs the IG pivoting rule destructs per iteration
+ * @return the destruction size as set in the configuration
+ */
+/**********************************************************************************/
+int Configuration::getDestructionSize(){
+    return this->destructionSize;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to set the number of jobs the IG pivoting rule destructs per iteration
+ * @param destructionSize the new destruction size, at least 1
+ */
+/**********************************************************************************/
+void Configuration::setDestructionSize(int destructionSize){
+    this->destructionSize = destructionSize;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to obtain the number of iterations a move of the TS pivoting rule stays
+ * tabu
+ * @return the tabu tenure as set in the configuration, 0 for the default tenure of
+ *         the instance
+ */
+/**********************************************************************************/
+int Configuration::getTabuTenure(){
+    return this->tabuTenure;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to set the number of iterations a move of the TS pivoting rule stays tabu
+ * @param tabuTenure the new tabu tenure, 0 for the default tenure of the instance
+ */
+/**********************************************************************************/
+void Configuration::setTabuTenure(int tabuTenure){
+    this->tabuTenure = tabuTenure;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to obtain the number of members of the population of the GA pivoting rule
+ * @return the population size as set in the configuration
+ */
+/**********************************************************************************/
+int Configuration::getPopulationSize(){
+    return this->populationSize;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to set the number of members of the population of the GA pivoting rule
+ * @param populationSize the new population size, at least 2
+ */
+/**********************************************************************************/
+void Configuration::setPopulationSize(int populationSize){
+    this->populationSize = populationSize;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to obtain the crossover of the GA pivoting rule
+ * @return the crossover as set in the configuration
+ */
+/**********************************************************************************/
+Crossover Configuration::getCrossover(){
+    return this->crossover;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to set the crossover of the GA pivoting rule
+ * @param crossover OX for the order crossover, PMX for the partially mapped crossover,
+ *                  SJOX for the similar job order crossover
+ */
+/**********************************************************************************/
+void Configuration::setCrossover(Crossover crossover){
+    this->crossover = crossover;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to obtain the acceptance criterion of the iterated local search
+ * @return the acceptance criterion as set in the configuration
+ */
+/**********************************************************************************/
+IlsAcceptance Configuration::getIlsAcceptance(){
+    return this->ilsAcceptance;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to set the acceptance criterion of the iterated local search
+ * @param ilsAcceptance BETTER to continue from a better local optimum only, WALK to
+ *                      continue from every local optimum, RESTART to continue from
+ *                      a better local optimum and restart from a random solution
+ *                      when the best solution stagnates
+ */
+/**********************************************************************************/
+void Configuration::setIlsAcceptance(IlsAcceptance ilsAcceptance){
+    this->ilsAcceptance = ilsAcceptance;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to obtain the number of islands (chains of SA, ILS, IG, TS or GA) run in parallel
+ * @return the number of chains as set in the configuration
+ */
+/**********************************************************************************/
+int Configuration::getNbrOfChains(){
+    return this->nbrOfChains;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to set the number of islands (chains of SA, ILS, IG, TS or GA) run in parallel
+ * @param nbrOfChains the new number of chains, at least 1
+ */
+/**********************************************************************************/
+void Configuration::setNbrOfChains(int nbrOfChains){
+    this->nbrOfChains = nbrOfChains;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to obtain the number of iterations (ILS, IG, TS), generations (GA) or temperature levels (SA)
+ * between two migrations of the islands
+ * @return the migration interval as set in the configuration, 0 for no migration
+ */
+/**********************************************************************************/
+int Configuration::getMigrationInterval(){
+    return this->migrationInterval;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to set the number of iterations (ILS, IG, TS), generations (GA) or temperature levels (SA)
+ * between two migrations of the islands
+ * @param migrationInterval the new migration interval, 0 for no migration
+ */
+/**********************************************************************************/
+void Configuration::setMigrationInterval(int migrationInterval){
+    this->migrationInterval = migrationInterval;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to obtain the policy with which an island adopts a migrant
+ * @return the migrant adoption as set in the configuration
+ */
+/**********************************************************************************/
+MigrantAdoption Configuration::getMigrantAdoption(){
+    return this->migrantAdoption;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to set the policy with which an island adopts a migrant
+ * @param migrantAdoption IMPROVING to adopt a migrant that is better than the 
+ *                        current solution of the island, ALWAYS to adopt every 
+ *                        migrant
+ */
+/**********************************************************************************/
+void Configuration::setMigrantAdoption(MigrantAdoption migrantAdoption){
+    this->migrantAdoption = migrantAdoption;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to obtain the search the islands run
+ * @return the island mix as set in the configuration
+ */
+/**********************************************************************************/
+IslandMix Configuration::getIslandMix(){
+    return this->islandMix;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to set the search the islands run
+ * @param islandMix SAME to run the configured search on every island, MIXED to run
+ *                  SA on every other island (IG when SA is configured)
+ */
+/**********************************************************************************/
+void Configuration::setIslandMix(IslandMix islandMix){
+    this->islandMix = islandMix;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to obtain the number of threads that evaluate a neighbourhood
+ * @return the number of threads as set in the configuration
+ */
+/**********************************************************************************/
+int Configuration::getNbrOfThreads(){
+    return this->nbrOfThreads;
+};
+
+
+/**********************************************************************************/
+/**
+ * function to set the number of threads that evaluate a neighbourhood
+ * @param nbrOfThreads the new number of threads, 1 to evaluate on the solving thread
+ */
+/**********************************************************************************/
+void Configuration::setNbrOfThreads(int nbrOfThreads){
+    this->nbrOfThreads = nbrOfThreads;
+};
+
+
 /**********************************************************************************/
 /**
  * internal function used to convert a boolean value to a corresponding string
@@ -241,10 +605,40 @@ string Configuration::asString(){
     str += PIVOTING_RULE_STRINGS[this->pivotingRule];
     str += "\nsolver memory: ";
     str += SOLVER_MEMORY_STRINGS[this->solverMemory];
+    str += "\nmemory budget in MB (if applicable): ";
+    str += std::to_string(this->memoryBudget);
+    str += "\nfalse positive rate (if applicable): ";
+    str += std::to_string(this->falsePositiveRate);
     str += "\nannealing decay (if applicable): ";
     str += std::to_string(this->annealingDecay);
     str += "\nannealing limit (if applicable): ";
     str += std::to_string(this->annealingLimit);
+    str += "\ncooling schedule (if applicable): ";
+    str += COOLING_STRINGS[this->cooling];
+    str += "\ntime limit (0 for default): ";
+    str += std::to_string(this->timeLimit);
+    str += " ";
+    str += TIME_BUDGET_STRINGS[this->timeBudget];
+    str += "\njobs destructed per iteration (if applicable): ";
+    str += std::to_string(this->destructionSize);
+    str += "\ntabu tenure (if applicable, 0 for default): ";
+    str += std::to_string(this->tabuTenure);
+    str += "\npopulation size (if applicable): ";
+    str += std::to_string(this->populationSize);
+    str += "\ncrossover (if applicable): ";
+    str += CROSSOVER_STRINGS[this->crossover];
+    str += "\nacceptance of the iterated local search (if applicable): ";
+    str += ILS_ACCEPTANCE_STRINGS[this->ilsAcceptance];
+    str += "\nnumber of parallel islands of SA, ILS, IG, TS and GA (if applicable): ";
+    str += std::to_string(this->nbrOfChains);
+    str += "\nmigration interval of the islands (0 for no migration): ";
+    str += std::to_string(this->migrationInterval);
+    str += "\nadoption of migrants by the islands (if applicable): ";
+    str += MIGRANT_ADOPTION_STRINGS[this->migrantAdoption];
+    str += "\nsearch of the islands (if applicable): ";
+    str += ISLAND_MIX_STRINGS[this->islandMix];
+    str += "\nnumber of threads evaluating a neighbourhood: ";
+    str += std::to_string(this->nbrOfThreads);
     str += "\nnumber of pertubations on intermediate solution: ";
     str += std::to_string(this->pertubationValue);
     str += "\nselect randomly when results are equal: ";
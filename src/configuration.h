@@ -13,14 +13,26 @@ using std::string,std::vector;
 // enum types for the given parameters
 enum InitSolution {RANDOM, SRZH};
 enum Neigbourhood {TRANSPOSE,EXCHANGE,INSERT,TEI,TIE};
-enum Pivotrules {FIRST, BEST,ANNEAL};
-enum SolverMemory {NONE,HASH,MAP};
+enum Pivotrules {FIRST, BEST,ANNEAL,SA,IG,TS,GA,BB};
+enum SolverMemory {NONE,HASH,MAP,FLAT,BLOOM,ADAPTIVE};
+enum Cooling {FIXED,TIMED};
+enum TimeBudget {WALL,CPU,NM,EVALS,EVALSNM};
+enum IlsAcceptance {BETTER,WALK,RESTART};
+enum MigrantAdoption {IMPROVING,ALWAYS};
+enum IslandMix {SAME,MIXED};
+enum Crossover {OX,PMX,SJOX};
 
 // string versions of the enum types, used for printing the values
 const string INIT_SOLUTION_STRINGS[2] {"RANDOM", "SRZH"};
 const string NEIGHBOURHOOD_STRINGS[5] {"TRANSPOSE","EXCHANGE","INSERT","TEI","TIE"};
-const string PIVOTING_RULE_STRINGS[3] {"FIRST","BEST","ANNEAL"};
-const string SOLVER_MEMORY_STRINGS[3] {"NONE","HASH","MAP"};
+const string PIVOTING_RULE_STRINGS[8] {"FIRST","BEST","ANNEAL","SA","IG","TS","GA","BB"};
+const string SOLVER_MEMORY_STRINGS[6] {"NONE","HASH","MAP","FLAT","BLOOM","ADAPTIVE"};
+const string COOLING_STRINGS[2] {"FIXED","TIMED"};
+const string TIME_BUDGET_STRINGS[5] {"WALL","CPU","NM","EVALS","EVALSNM"};
+const string ILS_ACCEPTANCE_STRINGS[3] {"BETTER","WALK","RESTART"};
+const string MIGRANT_ADOPTION_STRINGS[2] {"IMPROVING","ALWAYS"};
+const string ISLAND_MIX_STRINGS[2] {"SAME","MIXED"};
+const string CROSSOVER_STRINGS[3] {"OX","PMX","SJOX"};
 
 
 // class definition
@@ -36,6 +48,21 @@ class Configuration{
         int pertubationValue;
         bool chooseRandomWhenEqual;
         int seed;
+        long int memoryBudget;
+        float falsePositiveRate;
+        Cooling cooling;
+        TimeBudget timeBudget;
+        float timeLimit;
+        int destructionSize;
+        int tabuTenure;
+        int populationSize;
+        Crossover crossover;
+        IlsAcceptance ilsAcceptance;
+        int nbrOfChains;
+        int migrationInterval;
+        MigrantAdoption migrantAdoption;
+        IslandMix islandMix;
+        int nbrOfThreads;
     
     public:
         Configuration(
@@ -54,6 +81,7 @@ class Configuration{
         ~Configuration();
         
         Pivotrules getPivotingRule();
+        void setPivotingRule(Pivotrules pivotingRule);
         Neigbourhood getNeighbourhood();
         vector<Neigbourhood> getNeighbourhoodVector();
         InitSolution getInitSolution();
@@ -64,6 +92,35 @@ class Configuration{
         bool getChooseRandomWhenEqual();
         int getSeed();
         void setSeed(int seed);
+        long int getMemoryBudget();
+        void setMemoryBudget(long int memoryBudget);
+        float getFalsePositiveRate();
+        void setFalsePositiveRate(float falsePositiveRate);
+        Cooling getCooling();
+        void setCooling(Cooling cooling);
+        TimeBudget getTimeBudget();
+        float getTimeLimit();
+        void setTimeLimit(TimeBudget timeBudget, float timeLimit);
+        int getDestructionSize();
+        void setDestructionSize(int destructionSize);
+        int getTabuTenure();
+        void setTabuTenure(int tabuTenure);
+        int getPopulationSize();
+        void setPopulationSize(int populationSize);
+        Crossover getCrossover();
+        void setCrossover(Crossover crossover);
+        IlsAcceptance getIlsAcceptance();
+        void setIlsAcceptance(IlsAcceptance ilsAcceptance);
+        int getNbrOfChains();
+        void setNbrOfChains(int nbrOfChains);
+        int getMigrationInterval();
+        void setMigrationInterval(int migrationInterval);
+        MigrantAdoption getMigrantAdoption();
+        void setMigrantAdoption(MigrantAdoption migrantAdoption);
+        IslandMix getIslandMix();
+        void setIslandMix(IslandMix islandMix);
+        int getNbrOfThreads();
+        void setNbrOfThreads(int nbrOfThreads);
         string getDatafile();
 
         string asString();
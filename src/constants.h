@@ -18,18 +18,43 @@ const long int MAX_DURATION_5 = 5000;
 const long int MAX_DURATION_50 = 160000;
 const long int MAX_DURATION_100 = 2100000;
 
+// default max duration per job and machine of instances with another number of jobs
+const double MAX_DURATION_PER_JOB_MACHINE = 160;
+
 // constants used by the Simulated annealing testrun
 const float ANNEAL_DECAY = 0.99995;
 const float ANNEAL_RUN_LIMIT = 0;
 const int INIT_ANNEAL_TEMP_MULTIPLIER = 2;
 const int MINIMAL_ANNEAL_TEMP = 5000;
 
+// the SA pivoting rule accepts a single move on its absolute score difference, at 
+// the temperature floor of ANNEAL it would keep accepting large deteriorations
+const float MINIMAL_SINGLE_MOVE_ANNEAL_TEMP = 1;
+
+// with TIMED cooling, the temperature is raised again to the temperature at which the
+// best solution was found when no better solution is found during this fraction of
+// the max duration
+const float ANNEAL_REHEAT_FRACTION = 0.1;
+
+// the IG pivoting rule accepts a worse solution at a constant temperature of this
+// factor times the average processing time of an operation divided by 10
+const float IG_TEMPERATURE_FACTOR = 0.5;
+
 // constants used by the ILS testrun
 const int PERTUBATION_VALUE_0 = 0;
 const int PERTUBATION_VALUE_5 = 3;
 const int PERTUBATION_VALUE_50 = 5;
 const int PERTUBATION_VALUE_100 = 10;
 
+// constants used by the island testrun: every run is a MIXED island model of IG and
+// SA that migrates every ISLAND_RUN_MIGRATION_INTERVAL iterations or levels
+const int ISLAND_RUN_MIGRATION_INTERVAL = 10;
+const int ISLAND_RUN_MIN_ISLANDS = 2;
+
+// the RESTART acceptance of the iterated local search restarts from a random solution
+// every time the best solution did not improve for this number of iterations
+const int ILS_RESTART_ITERATIONS = 100;
+
 // defaults for the configuration of a single test
 const string DEFAULT_INITSOLUTION = "RANDOM";
 const string DEFAULT_NEIGHBOURHOOD = "TRANSPOSE";
@@ -38,5 +63,64 @@ const string DEFAULT_SOLVERMEMORY = "NONE";
 const string DEFAULT_ANNEALING_DECAY = "0.992";
 const string DEFAULT_ANNEALING_LIMIT = "0";
 const string DEFAULT_PERTUBATION_VALUE = "0";
+const string DEFAULT_COOLING = "FIXED";
+const string DEFAULT_TIME_BUDGET = "WALL";
+const string DEFAULT_ILS_ACCEPTANCE = "BETTER";
+
+// time limit of the solver, 0 selects the max duration of the instance size
+const float DEFAULT_TIME_LIMIT = 0;
+
+// number of jobs the IG pivoting rule destructs and reconstructs per iteration
+const int DEFAULT_DESTRUCTION_SIZE = 8;
+
+// number of iterations a move of the TS pivoting rule stays tabu, 0 selects the
+// instance default of a tenth of the number of jobs but at least TABU_MIN_TENURE
+const int DEFAULT_TABU_TENURE = 0;
+const int TABU_MIN_TENURE = 7;
+
+// number of members of the population of the GA pivoting rule and its crossover
+const int DEFAULT_POPULATION_SIZE = 20;
+const string DEFAULT_CROSSOVER = "SJOX";
+
+// probability that the GA pivoting rule shifts a job of an offspring after the
+// crossover, and the evaluations the local search of an offspring may use, in
+// squared numbers of jobs
+const double GA_MUTATION_PROBABILITY = 0.5;
+const int GA_LOCAL_SEARCH_EVALUATIONS = 1;
+
+// the elite pool of the runs on one instance in the folder runners: its capacity,
+// the minimal distance between its members as a divisor of the number of jobs (but 
+// at least ELITE_MIN_DISTANCE) and the evaluations the local search after a path
+// relinking walk may use, in squared numbers of jobs
+const int ELITE_POOL_SIZE = 10;
+const int ELITE_DISTANCE_DIVISOR = 10;
+const int ELITE_MIN_DISTANCE = 2;
+const int RELINKING_LOCAL_SEARCH_EVALUATIONS = 4;
+
+// the BB pivoting rule: the largest instance it handles (the jobs of a partial 
+// sequence are the bits of a 64 bit set), the evaluations the descent of its first
+// schedule may use, in squared numbers of jobs, and the number of jobs of the 
+// partial sequences whose subtrees are explored in parallel
+const int BB_MAX_JOBS = 63;
+const int BB_LOCAL_SEARCH_EVALUATIONS = 1;
+const int BB_ROOT_DEPTH = 2;
+
+// number of islands (chains of SA, ILS, IG, TS or GA) that run in parallel
+const int DEFAULT_NBR_OF_CHAINS = 1;
+
+// number of iterations (ILS, IG, TS), generations (GA) or temperature levels (SA) between two migrations
+// of the islands, 0 for islands that only share their best solution
+const int DEFAULT_MIGRATION_INTERVAL = 0;
+const string DEFAULT_MIGRANT_ADOPTION = "IMPROVING";
+const string DEFAULT_ISLAND_MIX = "SAME";
+
+// number of threads that evaluate a neighbourhood within one solve
+const int DEFAULT_NBR_OF_THREADS = 1;
+
+// byte budget of the FLAT, BLOOM and ADAPTIVE solver memory in megabytes
+const long int DEFAULT_MEMORY_BUDGET = 256;
+
+// false positive rate the BLOOM solver memory may reach before it is cleared
+const float DEFAULT_FALSE_POSITIVE_RATE = 0.001;
 
 #endif
\ No newline at end of file
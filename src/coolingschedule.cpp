@@ -0,0 +1,139 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* file contains the cooling schedule of simulated annealing. FIXED cooling
+/* multiplies the temperature with the annealing decay on every step. TIMED cooling
+/* measures the number of steps per unit of the budget of the deadline achieved so
+/* far and derives the decay on every step, so that the minimal temperature is 
+/* reached when the deadline expires. When the best solution does not improve for a
+/* fraction of the budget, it reheats to the temperature at which the best solution
+/* was found. With a budget of evaluations the schedule does not depend on the speed
+/* of the machine.
+/********************************************************************************/
+#include <cmath>
+#include <algorithm>
+
+#include "coolingschedule.h"
+
+#include "constants.h"
+#include "configuration.h"
+#include "deadline.h"
+
+
+/**********************************************************************************/
+/**
+ * constructor
+ * @param cooling FIXED or TIMED
+ * @param decay the decay used by FIXED cooling and by TIMED cooling on its first step
+ */
+/**********************************************************************************/
+CoolingSchedule::CoolingSchedule(Cooling cooling, float decay){
+    this->cooling = cooling;
+    this->decay = decay;
+    this->temperature = 0;
+    this->minimalTemperature = 0;
+    this->deadline = nullptr;
+    this->nbrOfSteps = 0;
+    this->bestTemperature = 0;
+    this->lastImprovement = 0;
+    this->nbrOfReheats = 0;
+}
+
+
+/**********************************************************************************/
+/**
+ * destructor
+ */
+/**********************************************************************************/
+CoolingSchedule::~CoolingSchedule(){
+}
+
+
+/**********************************************************************************/
+/**
+ * starts the schedule
+ * @param initialTemperature the temperature to start with
+ * @param minimalTemperature the temperature the schedule does not go below
+ * @param deadline the started deadline of the search, TIMED cooling spreads the 
+ *                 steps over its budget
+ */
+/**********************************************************************************/
+void CoolingSchedule::start(float initialTemperature, float minimalTemperature, Deadline & deadline){
+    this->temperature = initialTemperature;
+    this->minimalTemperature = minimalTemperature;
+    this->deadline = &deadline;
+    this->nbrOfSteps = 0;
+    this->bestTemperature = initialTemperature;
+    this->lastImprovement = 0;
+    this->nbrOfReheats = 0;
+}
+
+
+/**********************************************************************************/
+/**
+ * lowers the temperature by one step. TIMED cooling estimates the number of steps
+ * left from the steps per unit of the budget so far and takes the decay that 
+ * reaches the minimal temperature in that number of steps.
+ */
+/**********************************************************************************/
+void CoolingSchedule::cool(){
+    ++nbrOfSteps;
+    if(cooling == TIMED){
+        const double elapsed = deadline->getElapsed();
+        const double budget = deadline->getBudget();
+
+        // reheat when the search stagnates, not more than once per stagnation period
+        if(elapsed - lastImprovement > ANNEAL_REHEAT_FRACTION * budget && temperature < bestTemperature){
+            temperature = bestTemperature;
+            lastImprovement = elapsed;
+            ++nbrOfReheats;
+        }
+        if(elapsed > 0 && temperature > minimalTemperature){
+            const double stepsLeft = std::max(1.0, (budget - elapsed) * nbrOfSteps / elapsed);
+            decay = std::pow(minimalTemperature / temperature, 1.0 / stepsLeft);
+        }
+    }
+    temperature = temperature * decay;
+    if(temperature <= minimalTemperature) temperature = minimalTemperature;
+}
+
+
+/**********************************************************************************/
+/**
+ * registers that the best solution improved at the current temperature
+ */
+/**********************************************************************************/
+void CoolingSchedule::registerImprovement(){
+    if(cooling != TIMED) return;
+    bestTemperature = temperature;
+    lastImprovement = deadline->getElapsed();
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the current temperature
+ */
+/**********************************************************************************/
+float CoolingSchedule::getTemperature(){
+    return temperature;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the decay of the last step
+ */
+/**********************************************************************************/
+float CoolingSchedule::getDecay(){
+    return decay;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the number of times the temperature was raised again
+ */
+/**********************************************************************************/
+int CoolingSchedule::getNbrOfReheats(){
+    return nbrOfReheats;
+}
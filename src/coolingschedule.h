@@ -0,0 +1,42 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* headerfile for coolingschedule.cpp
+/********************************************************************************/
+#ifndef _COOLINGSCHEDULE_H_
+#define _COOLINGSCHEDULE_H_
+
+#include "configuration.h"
+#include "deadline.h"
+
+
+// class definition
+class CoolingSchedule{
+    private:
+        Cooling cooling;
+        float decay;
+        float temperature;
+        float minimalTemperature;
+
+        // the deadline whose budget is spread over the cooling steps
+        Deadline * deadline;
+        long int nbrOfSteps;
+
+        // temperature and budget used at the last improvement of the best solution
+        float bestTemperature;
+        double lastImprovement;
+        int nbrOfReheats;
+
+    public:
+        CoolingSchedule(Cooling cooling, float decay);
+        ~CoolingSchedule();
+
+        void start(float initialTemperature, float minimalTemperature, Deadline & deadline);
+        void cool();
+        void registerImprovement();
+
+        float getTemperature();
+        float getDecay();
+        int getNbrOfReheats();
+};
+
+#endif
@@ -0,0 +1,294 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* file contains the deadline of the solver. The budget is measured in wall time,
+/* in CPU time of the solving thread and of the threads that report helping it, or
+/* in evaluated neighbours. The solver checks the deadline before every evaluation,
+/* the clock is only read every DEADLINE_CHECK_INTERVAL checks so that a check
+/* costs a decrement. A budget of evaluations does not depend on the speed of the
+/* machine, so that a run with the same seed always ends in the same state. A 
+/* deadline can also be cancelled from another thread, or all at once on an
+/* interrupt, after which it expires on its next reading of the clock. While the
+/* solving thread does not check it, other threads can read the clock of the
+/* deadline, their evaluations are counted afterwards by the solving thread.
+/********************************************************************************/
+#include <chrono>
+#include <atomic>
+#include <ctime>
+#include <algorithm>
+#include <cmath>
+#include <pthread.h>
+
+#include "deadline.h"
+
+#include "constants.h"
+#include "configuration.h"
+#include "helpers.h"
+
+// set when all deadlines are cancelled, e.g. on an interrupt of the program
+static std::atomic<bool> allCancelled(false);
+
+
+/**********************************************************************************/
+/**
+ * the default time limit of an instance. The sizes of the test instances keep their
+ * own limit, other sizes get a limit proportional to the number of jobs times the
+ * number of machines.
+ * @param nbrOfJobs the number of jobs of the instance
+ * @param nbrOfMachines the number of machines of the instance
+ * @return the time limit in milliseconds
+ */
+/**********************************************************************************/
+long int getDefaultTimeLimit(int nbrOfJobs, int nbrOfMachines){
+    switch(nbrOfJobs){
+        case 5: return MAX_DURATION_5;
+        case 50: return MAX_DURATION_50;
+        case 100: return MAX_DURATION_100;
+    }
+    return static_cast<long int>(MAX_DURATION_PER_JOB_MACHINE * nbrOfJobs * nbrOfMachines);
+}
+
+
+/**********************************************************************************/
+/**
+ * the budget of a configuration for an instance
+ * @param config the configuration, a time limit of 0 selects the default limit
+ * @param nbrOfJobs the number of jobs of the instance
+ * @param nbrOfMachines the number of machines of the instance
+ * @return the budget in milliseconds or, for EVALS and EVALSNM, in evaluations
+ */
+/**********************************************************************************/
+double getBudget(Configuration & config, int nbrOfJobs, int nbrOfMachines){
+    const bool countsEvaluations = config.getTimeBudget() == EVALS || config.getTimeBudget() == EVALSNM;
+    if(countsEvaluations && config.getTimeLimit() <= 0) 
+        generateError("ERROR. file:deadline.cpp, method:getBudget. a budget of evaluations needs a positive limit");
+    if(config.getTimeLimit() <= 0) return getDefaultTimeLimit(nbrOfJobs, nbrOfMachines);
+    if(config.getTimeBudget() == NM || config.getTimeBudget() == EVALSNM) 
+        return static_cast<double>(config.getTimeLimit()) * nbrOfJobs * nbrOfMachines;
+    return config.getTimeLimit();
+}
+
+
+/**********************************************************************************/
+/**
+ * constructor
+ * @param timeBudget WALL or NM to measure wall time, CPU to measure the CPU time
+ *                   of the thread that starts the deadline, EVALS or EVALSNM to 
+ *                   count evaluations
+ * @param budget the budget in milliseconds or evaluations
+ */
+/**********************************************************************************/
+Deadline::Deadline(TimeBudget timeBudget, double budget): cancelled(false), helperCpuTime(0){
+    this->timeBudget = timeBudget;
+    this->budget = budget;
+    this->countsEvaluations = (timeBudget == EVALS || timeBudget == EVALSNM);
+    this->startCpuTime = 0;
+    this->cpuClock = CLOCK_THREAD_CPUTIME_ID;
+    this->nbrOfChecks = 0;
+    this->expired = false;
+    this->startTime = std::chrono::steady_clock::now();
+    this->countdown = getCountdown();
+}
+
+
+/**********************************************************************************/
+/**
+ * destructor
+ */
+/**********************************************************************************/
+Deadline::~Deadline(){
+}
+
+
+/**********************************************************************************/
+/**
+ * @param clock the CPU clock of a thread, CLOCK_THREAD_CPUTIME_ID for the calling
+ *              thread
+ * @return the CPU time of the thread in milliseconds
+ */
+/**********************************************************************************/
+double Deadline::getCpuTime(clockid_t clock){
+    timespec time;
+    clock_gettime(clock, &time);
+    return time.tv_sec * 1000.0 + time.tv_nsec / 1000000.0;
+}
+
+
+/**********************************************************************************/
+/**
+ * starts measuring the time budget, must be called by the solving thread
+ */
+/**********************************************************************************/
+void Deadline::start(){
+    startTime = std::chrono::steady_clock::now();
+    if(timeBudget == CPU){
+        if(pthread_getcpuclockid(pthread_self(), &cpuClock) != 0) cpuClock = CLOCK_THREAD_CPUTIME_ID;
+        startCpuTime = getCpuTime(cpuClock);
+        helperCpuTime.store(0);
+    }
+    nbrOfChecks = 0;
+    expired = false;
+    countdown = getCountdown();
+}
+
+
+/**********************************************************************************/
+/**
+ * cancels the deadline, can be called from any thread
+ */
+/**********************************************************************************/
+void Deadline::cancel(){
+    cancelled.store(true, std::memory_order_relaxed);
+}
+
+
+/**********************************************************************************/
+/**
+ * cancels every deadline, also the ones that start later, so that all running 
+ * searches stop with their best solution. The flag is lock free, so this can be
+ * called from a signal handler.
+ */
+/**********************************************************************************/
+void cancelAllDeadlines(){
+    allCancelled.store(true, std::memory_order_relaxed);
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the number of checks until the next reading of the clock, a budget of 
+ *         evaluations is read at the check that would exceed it
+ */
+/**********************************************************************************/
+int Deadline::getCountdown(){
+    if(!countsEvaluations) return DEADLINE_CHECK_INTERVAL;
+    return static_cast<int>(std::clamp(budget - nbrOfChecks + 1, 1.0, static_cast<double>(DEADLINE_CHECK_INTERVAL)));
+}
+
+
+/**********************************************************************************/
+/**
+ * reads the clock and restarts the countdown to the next reading. The check that
+ * would exceed a budget of evaluations expires the deadline.
+ * @return true if the deadline expired or was cancelled
+ */
+/**********************************************************************************/
+bool Deadline::readClock(){
+    countdown = getCountdown();
+    if(countsEvaluations) expired = nbrOfChecks > budget;
+    else expired = getElapsed() >= budget;
+    expired = expired || cancelled.load(std::memory_order_relaxed) || allCancelled.load(std::memory_order_relaxed);
+    return expired;
+}
+
+
+/**********************************************************************************/
+/**
+ * check that always reads the clock
+ * @return true if the deadline expired or was cancelled
+ */
+/**********************************************************************************/
+bool Deadline::checkNow(){
+    if(expired) return true;
+    return readClock();
+}
+
+
+/**********************************************************************************/
+/**
+ * counts evaluations that were done without a check, by other threads, and reads 
+ * the clock
+ * @param nbrOfEvaluations the number of evaluations
+ * @return true if the deadline expired or was cancelled
+ */
+/**********************************************************************************/
+bool Deadline::checkEvaluations(long int nbrOfEvaluations){
+    if(expired) return true;
+    nbrOfChecks += nbrOfEvaluations;
+    return readClock();
+}
+
+
+/**********************************************************************************/
+/**
+ * reads the clock without changing the deadline, can be called from any thread as
+ * long as the solving thread does not check the deadline at the same time
+ * @return true if a budget of wall or CPU time is used up or the deadline was 
+ *         cancelled, a budget of evaluations is only checked by the solving thread
+ */
+/**********************************************************************************/
+bool Deadline::isTimeUp(){
+    if(cancelled.load(std::memory_order_relaxed) || allCancelled.load(std::memory_order_relaxed)) return true;
+    if(countsEvaluations) return false;
+    return getElapsed() >= budget;
+}
+
+
+/**********************************************************************************/
+/**
+ * adds the CPU time that a thread helping the solving thread used since its previous
+ * call to a budget of CPU time, so that the budget also runs out while the solving
+ * thread waits for its helpers. Can be called from any thread.
+ * @param threadCpuTime the CPU time of the calling thread at its previous call, 0 
+ *                      for a thread that only ever helped this deadline
+ */
+/**********************************************************************************/
+void Deadline::addHelperCpuTime(double & threadCpuTime){
+    if(timeBudget != CPU) return;
+    const double cpuTime = getCpuTime(CLOCK_THREAD_CPUTIME_ID);
+    helperCpuTime.fetch_add(std::lround((cpuTime - threadCpuTime) * 1000.0), std::memory_order_relaxed);
+    threadCpuTime = cpuTime;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return true if the deadline was found expired by an earlier check
+ */
+/**********************************************************************************/
+bool Deadline::hasExpired(){
+    return expired;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the milliseconds or evaluations of the budget used since the start, the
+ *         check that expired the deadline is not an evaluation
+ */
+/**********************************************************************************/
+double Deadline::getElapsed(){
+    if(countsEvaluations) return expired ? nbrOfChecks - 1 : nbrOfChecks;
+    if(timeBudget == CPU) return getCpuTime(cpuClock) - startCpuTime + helperCpuTime.load(std::memory_order_relaxed) / 1000.0;
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the budget in milliseconds or evaluations
+ */
+/**********************************************************************************/
+double Deadline::getBudget(){
+    return budget;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return true if the budget counts evaluations instead of milliseconds
+ */
+/**********************************************************************************/
+bool Deadline::isEvaluationBudget(){
+    return countsEvaluations;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the milliseconds by which the time used so far exceeds the budget, 0 when
+ *         it does not exceed the budget or when the budget counts evaluations
+ */
+/**********************************************************************************/
+double Deadline::getOvershoot(){
+    return std::max(0.0, getElapsed() - budget);
+}
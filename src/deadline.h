@@ -0,0 +1,73 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* headerfile for deadline.cpp
+/********************************************************************************/
+#ifndef _DEADLINE_H_
+#define _DEADLINE_H_
+
+#include <chrono>
+#include <atomic>
+#include <ctime>
+
+#include "configuration.h"
+
+// number of calls to check between two readings of the clock
+const int DEADLINE_CHECK_INTERVAL = 256;
+
+long int getDefaultTimeLimit(int nbrOfJobs, int nbrOfMachines);
+double getBudget(Configuration & config, int nbrOfJobs, int nbrOfMachines);
+void cancelAllDeadlines();
+
+
+// class definition
+class Deadline{
+    private:
+        TimeBudget timeBudget;
+        double budget;
+        std::chrono::steady_clock::time_point startTime;
+        double startCpuTime;
+        int countdown;
+        bool expired;
+
+        // every check counts one evaluation, a budget of evaluations is checked exactly
+        bool countsEvaluations;
+        long int nbrOfChecks;
+        std::atomic<bool> cancelled;
+
+        // the CPU clock of the solving thread and the CPU time in microseconds that
+        // threads helping the solving thread added to a budget of CPU time
+        clockid_t cpuClock;
+        std::atomic<long int> helperCpuTime;
+
+        double getCpuTime(clockid_t clock);
+        int getCountdown();
+        bool readClock();
+
+    public:
+        Deadline(TimeBudget timeBudget, double budget);
+        ~Deadline();
+
+        void start();
+        void cancel();
+
+        // amortised check before every evaluation: the clock is only read every 
+        // DEADLINE_CHECK_INTERVAL calls, once expired it stays expired
+        inline bool check(){
+            if(expired) return true;
+            ++nbrOfChecks;
+            if(--countdown > 0) return false;
+            return readClock();
+        }
+        bool checkNow();
+        bool checkEvaluations(long int nbrOfEvaluations);
+        bool hasExpired();
+        bool isTimeUp();
+        void addHelperCpuTime(double & threadCpuTime);
+
+        double getElapsed();
+        double getBudget();
+        bool isEvaluationBudget();
+        double getOvershoot();
+};
+
+#endif
@@ -0,0 +1,112 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* file contains the first improvement descent that improves a solution on the
+/* caches of one worker, used for the offspring of the memetic algorithm and the
+/* intermediates of the path relinking. Unlike the local search of the solver it
+/* needs no solver state, so that several workers descend at the same time. The
+/* number of evaluations of a descent is limited and counted by the caller.
+/********************************************************************************/
+#include <vector>
+
+#include "descent.h"
+
+#include "neighbourhood.h"
+#include "evaluator.h"
+#include "deadline.h"
+
+
+/**********************************************************************************/
+/**
+ * evaluates the neighbours of the solution of a worker and moves the solution to
+ * the first improving neighbour. The wall clock of the deadline is read every
+ * DEADLINE_CHECK_INTERVAL evaluations.
+ * @param worker the worker
+ * @param moves the moves of the neighbourhood, of neighbourhood type TYPE
+ * @param objectiveScore the score of the solution, replaced on improvement
+ * @param limit the number of evaluations the descent may use
+ * @param deadline the deadline of the descent, or nullptr
+ * @param evaluations the evaluations of the descent so far, updated
+ * @param pruned the evaluations that were stopped early so far, updated
+ * @return true if the solution improved
+ */
+/**********************************************************************************/
+template<Neigbourhood TYPE>
+bool scanNeighbourhoodOfWorker(DescentWorker & worker, MoveGenerator & moves, long int & objectiveScore, long int limit,
+                               Deadline * deadline, long int & evaluations, long int & pruned){
+    worker.cache.setSequence(worker.solution);
+    worker.neighbour = worker.solution;
+    int partialPosition = 0;
+
+    // only a neighbour that beats the solution needs an exact score
+    const long int cutoff = objectiveScore - 1;
+    for(int i = 0; i < moves.size(); ++i){
+        if(evaluations >= limit || (deadline && evaluations % DEADLINE_CHECK_INTERVAL == 0 && deadline->isTimeUp())){
+            worker.stopped = true;
+            return false;
+        }
+        ++evaluations;
+
+        const Move & move = moves[i];
+        bool neighbourPruned = false;
+        long int neighbourObjectiveScore;
+        if(TYPE == INSERT){
+            if(move.first != partialPosition){
+                worker.partialSolution = worker.solution;
+                worker.partialSolution.erase(worker.partialSolution.begin() + move.first);
+                worker.partialCache.setSequence(worker.partialSolution);
+                partialPosition = move.first;
+            }
+            neighbourObjectiveScore = worker.partialCache.evaluateInsertion(worker.solution[move.first], move.second, cutoff, &neighbourPruned);
+        }
+        else{
+            applyMove<TYPE>(worker.neighbour, move);
+            neighbourObjectiveScore = worker.cache.evaluate(worker.neighbour, move.first, cutoff, &neighbourPruned);
+            undoMove<TYPE>(worker.neighbour, move);
+        }
+        if(neighbourPruned){
+            ++pruned;
+            continue;
+        }
+        if(neighbourObjectiveScore < objectiveScore){
+            applyMove<TYPE>(worker.solution, move);
+            objectiveScore = neighbourObjectiveScore;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/**********************************************************************************/
+/**
+ * descends from the solution of a worker with first improvement over the
+ * neighbourhood sequence, until a local optimum or the evaluation limit is reached
+ * or the wall time of the deadline is up
+ * @param worker the worker, its solution is the solution to improve
+ * @param neighbourhoodSequence the neighbourhoods, only read
+ * @param objectiveScore the score of the solution
+ * @param limit the number of evaluations the descent may use
+ * @param deadline the deadline of the descent, or nullptr
+ * @param evaluations the evaluations of the descent so far, updated
+ * @param pruned the evaluations that were stopped early so far, updated
+ * @return the score of the improved solution
+ */
+/**********************************************************************************/
+long int descendWithFirstImprovement(DescentWorker & worker, vector<MoveGenerator> & neighbourhoodSequence,
+                                     long int objectiveScore, long int limit, Deadline * deadline,
+                                     long int & evaluations, long int & pruned){
+    worker.stopped = false;
+    bool improved = true;
+    while(improved && !worker.stopped){
+        improved = false;
+        for(int j = 0; j < neighbourhoodSequence.size() && !improved && !worker.stopped; ++j){
+            MoveGenerator & moves = neighbourhoodSequence[j];
+            switch (moves.getType()){
+                case TRANSPOSE: improved = scanNeighbourhoodOfWorker<TRANSPOSE>(worker, moves, objectiveScore, limit, deadline, evaluations, pruned); break;
+                case EXCHANGE:  improved = scanNeighbourhoodOfWorker<EXCHANGE>(worker, moves, objectiveScore, limit, deadline, evaluations, pruned); break;
+                default:        improved = scanNeighbourhoodOfWorker<INSERT>(worker, moves, objectiveScore, limit, deadline, evaluations, pruned); break;
+            }
+        }
+    }
+    return objectiveScore;
+}
@@ -0,0 +1,39 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* headerfile for descent.cpp
+/********************************************************************************/
+#ifndef _DESCENT_H_
+#define _DESCENT_H_
+
+#include <vector>
+
+#include "pfspinstance.h"
+#include "neighbourhood.h"
+#include "evaluator.h"
+#include "deadline.h"
+
+using std::vector;
+
+
+// the state with which one thread descends from a solution: its own caches of the
+// completion times and solutions to work on, so that several threads descend at the
+// same time
+struct DescentWorker{
+    CompletionTimesCache cache;
+    CompletionTimesCache partialCache;
+    vector<int> solution;
+    vector<int> neighbour;
+    vector<int> partialSolution;
+    vector<int> scratch;
+
+    // set when the descent ran out of evaluations or time
+    bool stopped = false;
+
+    DescentWorker(PfspInstance & pfspInstance): cache(pfspInstance), partialCache(pfspInstance){}
+};
+
+long int descendWithFirstImprovement(DescentWorker & worker, vector<MoveGenerator> & neighbourhoodSequence,
+                                     long int objectiveScore, long int limit, Deadline * deadline,
+                                     long int & evaluations, long int & pruned);
+
+#endif
@@ -0,0 +1,322 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* file contains the elite pool that collects the best distinct schedules of the
+/* runs on one instance, and the path relinking between its members. A schedule
+/* enters the pool when no member has the same permutation hash and no member that
+/* is at least as good lies within the minimal distance (the number of positions
+/* on which two schedules differ). The path relinking walks from the worse member
+/* of every pair to the better one by exchanging jobs into the positions they have
+/* in the better member, and descends from the best schedule on the way. The walks
+/* of the pairs run in parallel on a thread pool.
+/********************************************************************************/
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <memory>
+#include <functional>
+#include <string>
+
+#include "elitepool.h"
+
+#include "constants.h"
+#include "helpers.h"
+#include "neighbourhood.h"
+#include "evaluator.h"
+#include "descent.h"
+#include "threadpool.h"
+
+
+/**********************************************************************************/
+/**
+ * constructor, the pool starts empty
+ * @param capacity the maximal number of members
+ * @param minDistance the number of positions on which a new member must differ from
+ *                    every member that is at least as good
+ * @param nbrOfJobs the number of jobs of the instance
+ */
+/**********************************************************************************/
+ElitePool::ElitePool(int capacity, int minDistance, int nbrOfJobs): permutationHash(nbrOfJobs){
+    if(capacity <= 0) generateError("ERROR. file:elitepool.cpp, method:ElitePool. an elite pool needs a capacity");
+    this->capacity = capacity;
+    this->minDistance = minDistance;
+}
+
+
+/**********************************************************************************/
+/**
+ * destructor
+ */
+/**********************************************************************************/
+ElitePool::~ElitePool(){
+}
+
+
+/**********************************************************************************/
+/**
+ * offers a schedule to the pool. A schedule that is too close to a member that is
+ * at least as good is refused, otherwise it replaces the closest worse member
+ * within the minimal distance, or takes a free place, or replaces the worst member
+ * when it is better.
+ * @param objectiveScore the score of the schedule
+ * @param solution the schedule
+ * @return true if the schedule entered the pool
+ */
+/**********************************************************************************/
+bool ElitePool::offer(long int objectiveScore, const vector<int> & solution){
+    const std::uint64_t hash = permutationHash.computeHash(solution);
+    int closest = -1;
+    int closestDistance = minDistance;
+    int worst = -1;
+    for(int member = 0; member < solutions.size(); ++member){
+        if(hashes[member] == hash && solutions[member] == solution) return false;
+        const int distance = computeDistance(solutions[member], solution);
+        if(distance < minDistance && objectiveScores[member] <= objectiveScore) return false;
+        if(distance < closestDistance){
+            closest = member;
+            closestDistance = distance;
+        }
+        if(worst < 0 || objectiveScores[member] > objectiveScores[worst]) worst = member;
+    }
+
+    int place = closest;
+    if(place < 0 && solutions.size() < capacity){
+        solutions.push_back(solution);
+        objectiveScores.push_back(objectiveScore);
+        hashes.push_back(hash);
+        return true;
+    }
+    if(place < 0) place = worst;
+    if(objectiveScores[place] <= objectiveScore) return false;
+    solutions[place] = solution;
+    objectiveScores[place] = objectiveScore;
+    hashes[place] = hash;
+    return true;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the number of members
+ */
+/**********************************************************************************/
+int ElitePool::getSize(){
+    return solutions.size();
+}
+
+
+/**********************************************************************************/
+/**
+ * @param member the index of the member
+ * @return the schedule of the member
+ */
+/**********************************************************************************/
+const vector<int> & ElitePool::getSolution(int member){
+    return solutions[member];
+}
+
+
+/**********************************************************************************/
+/**
+ * @param member the index of the member
+ * @return the score of the member
+ */
+/**********************************************************************************/
+long int ElitePool::getObjectiveScore(int member){
+    return objectiveScores[member];
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the index of the best member (the lowest index at equal scores), -1 when
+ *         the pool is empty
+ */
+/**********************************************************************************/
+int ElitePool::getBestMember(){
+    if(solutions.empty()) return -1;
+    return std::min_element(objectiveScores.begin(), objectiveScores.end()) - objectiveScores.begin();
+}
+
+
+/**********************************************************************************/
+/**
+ * @param first a schedule
+ * @param second a schedule of the same size
+ * @return the number of positions on which the schedules differ
+ */
+/**********************************************************************************/
+int computeDistance(const vector<int> & first, const vector<int> & second){
+    int distance = 0;
+    for(int position = 1; position < first.size(); ++position) distance += first[position] != second[position];
+    return distance;
+}
+
+
+/**********************************************************************************/
+/**
+ * walks from the schedule of a worker to the guiding schedule. Every step scores
+ * all exchanges that put a job on its position in the guiding schedule on the
+ * cache of the current schedule, from the first exchanged position on and stopped
+ * as soon as they can not beat the best exchange of the step, and takes the best
+ * one. The best schedule strictly between the two ends is kept.
+ * @param worker the worker, its solution is the initiating schedule
+ * @param guide the guiding schedule
+ * @param intermediate set to the best schedule on the way, if any
+ * @param evaluations the evaluations of the walk so far, updated
+ * @param pruned the evaluations that were stopped early so far, updated
+ * @return the score of the best schedule on the way, NO_CUTOFF if the walk has no
+ *         schedule between its ends
+ */
+/**********************************************************************************/
+long int walkPath(DescentWorker & worker, const vector<int> & guide, vector<int> & intermediate,
+                  long int & evaluations, long int & pruned){
+    vector<int> & current = worker.solution;
+    vector<int> & positions = worker.scratch;
+    positions.resize(current.size());
+    for(int position = 1; position < current.size(); ++position) positions[current[position]] = position;
+    int remaining = computeDistance(current, guide);
+    long int intermediateObjectiveScore = NO_CUTOFF;
+
+    worker.cache.setSequence(current);
+    worker.neighbour = current;
+    while(remaining > 0){
+        long int bestStepObjectiveScore = NO_CUTOFF;
+        int bestFirst = 0;
+        int bestSecond = 0;
+        for(int position = 1; position < current.size(); ++position){
+            if(current[position] == guide[position]) continue;
+            const int other = positions[guide[position]];
+            ++evaluations;
+            bool stepPruned = false;
+            std::swap(worker.neighbour[position], worker.neighbour[other]);
+            const long int stepObjectiveScore = worker.cache.evaluate(worker.neighbour, std::min(position, other),
+                                                                      bestStepObjectiveScore, &stepPruned);
+            std::swap(worker.neighbour[position], worker.neighbour[other]);
+            if(stepPruned) ++pruned;
+            else if(stepObjectiveScore < bestStepObjectiveScore){
+                bestStepObjectiveScore = stepObjectiveScore;
+                bestFirst = position;
+                bestSecond = other;
+            }
+        }
+
+        std::swap(current[bestFirst], current[bestSecond]);
+        std::swap(worker.neighbour[bestFirst], worker.neighbour[bestSecond]);
+        positions[current[bestFirst]] = bestFirst;
+        positions[current[bestSecond]] = bestSecond;
+        remaining -= 1 + (current[bestSecond] == guide[bestSecond]);
+        worker.cache.setSequence(current);
+        if(remaining > 0 && bestStepObjectiveScore < intermediateObjectiveScore){
+            intermediateObjectiveScore = bestStepObjectiveScore;
+            intermediate = current;
+        }
+    }
+    return intermediateObjectiveScore;
+}
+
+
+/**********************************************************************************/
+/**
+ * relinks every pair of members of the elite pool: the walk from the worse member
+ * to the better one (see walkPath) is followed by a first improvement descent over
+ * the neighbourhoods of the configuration from the best schedule on the way, of at
+ * most RELINKING_LOCAL_SEARCH_EVALUATIONS times the squared number of jobs
+ * evaluations. The pairs are divided over a pool of threads, every thread with its
+ * own caches. The result does not depend on the number of threads: the local optima
+ * are offered to the elite pool in the order of the pairs afterwards.
+ * @param elitePool the elite pool, receives the local optima
+ * @param pfspInstance the instance of the schedules
+ * @param config the configuration with the neighbourhoods of the descent
+ * @param nbrOfThreads the number of threads
+ * @return a solverResult with the best member of the pool after relinking, the
+ *         evaluations and the duration of the relinking, and its statistics
+ */
+/**********************************************************************************/
+solverResult relinkElitePool(ElitePool & elitePool, PfspInstance & pfspInstance, Configuration & config, int nbrOfThreads){
+    auto start = std::chrono::high_resolution_clock::now();
+    const int nbrOfJobs = pfspInstance.getNbrOfJobs();
+    const long int localSearchLimit = static_cast<long int>(RELINKING_LOCAL_SEARCH_EVALUATIONS) * nbrOfJobs * nbrOfJobs;
+    const int poolBestMember = elitePool.getBestMember();
+    const long int poolBestObjectiveScore = elitePool.getObjectiveScore(poolBestMember);
+
+    vector<MoveGenerator> neighbourhoodSequence;
+    for(Neigbourhood type : config.getNeighbourhoodVector()) neighbourhoodSequence.push_back(MoveGenerator(type, nbrOfJobs));
+
+    // the worse member of a pair initiates the walk, the better one guides it
+    vector<std::pair<int, int>> pairs;
+    for(int first = 0; first < elitePool.getSize(); ++first)
+        for(int second = first + 1; second < elitePool.getSize(); ++second){
+            if(elitePool.getObjectiveScore(second) <= elitePool.getObjectiveScore(first)) pairs.push_back({first, second});
+            else pairs.push_back({second, first});
+        }
+
+    const int nbrOfWorkers = std::max(1, std::min<int>(nbrOfThreads, pairs.size()));
+    std::unique_ptr<ThreadPool> threadPool;
+    if(nbrOfWorkers > 1) threadPool.reset(new ThreadPool(nbrOfWorkers));
+    vector<DescentWorker> workers;
+    workers.reserve(nbrOfWorkers);
+    for(int worker = 0; worker < nbrOfWorkers; ++worker) workers.emplace_back(pfspInstance);
+
+    vector<vector<int>> localOptima(pairs.size());
+    vector<long int> localOptimumObjectiveScores(pairs.size(), NO_CUTOFF);
+    vector<long int> pairEvaluations(pairs.size(), 0);
+    vector<long int> pairPruned(pairs.size(), 0);
+    const std::function<void(int, int)> relinkPair = [&](int pair, int worker){
+        DescentWorker & state = workers[worker];
+        state.solution = elitePool.getSolution(pairs[pair].first);
+        const long int intermediateObjectiveScore = walkPath(state, elitePool.getSolution(pairs[pair].second), localOptima[pair],
+                                                             pairEvaluations[pair], pairPruned[pair]);
+        if(intermediateObjectiveScore == NO_CUTOFF) return;
+        state.solution = localOptima[pair];
+        localOptimumObjectiveScores[pair] = descendWithFirstImprovement(state, neighbourhoodSequence, intermediateObjectiveScore,
+                                                                        pairEvaluations[pair] + localSearchLimit, nullptr,
+                                                                        pairEvaluations[pair], pairPruned[pair]);
+        localOptima[pair] = state.solution;
+    };
+    if(threadPool) threadPool->run(pairs.size(), relinkPair);
+    else for(int pair = 0; pair < pairs.size(); ++pair) relinkPair(pair, 0);
+
+    long int evaluations = 0;
+    long int prunedEvaluations = 0;
+    int nbrOfAdopted = 0;
+    for(int pair = 0; pair < pairs.size(); ++pair){
+        evaluations += pairEvaluations[pair];
+        prunedEvaluations += pairPruned[pair];
+        if(localOptimumObjectiveScores[pair] != NO_CUTOFF && elitePool.offer(localOptimumObjectiveScores[pair], localOptima[pair]))
+            ++nbrOfAdopted;
+    }
+    const int bestMember = elitePool.getBestMember();
+
+    auto stop = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(stop - start);
+    solverResult result = {
+        .sequence = elitePool.getSolution(bestMember),
+        .objectiveScore = elitePool.getObjectiveScore(bestMember),
+        .duration = duration.count(),
+        .durationLimit = 0,
+        .overshoot = 0,
+        .evaluationsPerSecond = static_cast<float>(evaluations / std::chrono::duration<double>(stop - start).count()),
+        .neighboursTested = evaluations,
+        .neighbourhoodsTested = static_cast<long int>(pairs.size()),
+        .neighboursPruned = prunedEvaluations,
+        .initAnnealingTemp = 0,
+        .finalAnnealingTemp = 0,
+        .annealingSteps = 0,
+        .annealingReheats = 0,
+        .memorySize = 0,
+        .memoryRetrievals = 0,
+        .memoryMisses = 0,
+        .memoryEvictions = 0,
+        .memoryBytes = 0,
+        .memoryFalsePositiveRate = 0,
+        .memoryDecisions = "",
+        .migrantsReceived = 0,
+        .migrantsAdopted = 0,
+        .islandStatistics = "",
+        .relinkingStatistics = "pairs " + std::to_string(pairs.size()) + " adopted " + std::to_string(nbrOfAdopted) +
+                               " best of pool " + std::to_string(poolBestObjectiveScore),
+        .lowerBound = 0
+        };
+    return result;
+}
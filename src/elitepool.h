@@ -0,0 +1,45 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* headerfile for elitepool.cpp
+/********************************************************************************/
+#ifndef _ELITEPOOL_H_
+#define _ELITEPOOL_H_
+
+#include <vector>
+#include <cstdint>
+
+#include "pfspinstance.h"
+#include "configuration.h"
+#include "permutationhash.h"
+#include "solver.h"
+
+using std::vector;
+
+
+// class definition
+class ElitePool{
+    private:
+        int capacity;
+        int minDistance;
+        PermutationHash permutationHash;
+
+        // the members in the order in which they entered the pool
+        vector<vector<int>> solutions;
+        vector<long int> objectiveScores;
+        vector<std::uint64_t> hashes;
+
+    public:
+        ElitePool(int capacity, int minDistance, int nbrOfJobs);
+        ~ElitePool();
+
+        bool offer(long int objectiveScore, const vector<int> & solution);
+        int getSize();
+        const vector<int> & getSolution(int member);
+        long int getObjectiveScore(int member);
+        int getBestMember();
+};
+
+int computeDistance(const vector<int> & first, const vector<int> & second);
+solverResult relinkElitePool(ElitePool & elitePool, PfspInstance & pfspInstance, Configuration & config, int nbrOfThreads);
+
+#endif
@@ -0,0 +1,370 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM                                                                              
+/* file contains the incremental evaluation of (partial) solutions
+/********************************************************************************/
+#include <vector>
+#include <array>
+#include <algorithm>
+
+#include "evaluator.h"
+
+#include "pfspinstance.h"
+
+using std::vector;
+
+
+/**********************************************************************************/
+/**
+ * computes the contribution of one job to the objective
+ * @param objective the objective function to use
+ * @param completionTime the completion time of the job on the last machine
+ * @param dueDate the due date of the job
+ * @param priority the weight of the job
+ * @return the contribution of the job to the objective
+ */
+/**********************************************************************************/
+static inline long int computeJobObjective(Objective objective, long int completionTime, long int dueDate, long int priority){
+    if(objective == WEIGHTED_TARDINESS) return std::max(completionTime - dueDate, 0l) * priority;
+    else return completionTime * priority;
+}
+
+
+/**********************************************************************************/
+/**
+ * schedules one job behind the jobs whose end times are given
+ * @tparam FIXED_MACHINES the number of machines known at compile time, which 
+ *                        allows the loop to be unrolled, or 0 to use nbrOfMachines
+ * @param endTimes the end times of the previous job on every machine, updated
+ *                 in place to the end times of the scheduled job
+ * @param processTimes the processing times of the job to schedule
+ * @param nbrOfMachines the number of machines
+ * @return the completion time of the scheduled job on the last machine
+ */
+/**********************************************************************************/
+template <int FIXED_MACHINES = 0>
+static inline long int scheduleJob(long int* endTimes, const ProcessTime* processTimes, int nbrOfMachines){
+    const int machines = (FIXED_MACHINES > 0) ? FIXED_MACHINES : nbrOfMachines;
+    long int endTime = endTimes[0] + processTimes[0];
+    endTimes[0] = endTime;
+    for(int m = 1; m < machines; ++m){
+        endTime = std::max(endTime, endTimes[m]) + processTimes[m];
+        endTimes[m] = endTime;
+    }
+    return endTime;
+}
+
+
+/**********************************************************************************/
+/**
+ * computes a lower bound on the objective of the jobs that are not scheduled yet
+ * @param remaining the bound sums over the remaining jobs
+ * @param firstMachineEnd the end time of the last scheduled job on the first machine
+ * @param lastMachineEnd the end time of the last scheduled job on the last machine
+ * @return a lower bound on the objective of the remaining jobs
+ */
+/**********************************************************************************/
+static inline long int computeRemainingBound(const jobsBound & remaining, long int firstMachineEnd, long int lastMachineEnd){
+    return std::max({firstMachineEnd * remaining.weight + remaining.allMachines,
+                     lastMachineEnd * remaining.weight + remaining.lastMachine,
+                     0l});
+}
+
+
+/**********************************************************************************/
+/**
+ * removes the bound terms of a scheduled job from the sums of the remaining jobs
+ * @param remaining the bound sums over the remaining jobs
+ * @param job the bound terms of the job that got scheduled
+ */
+/**********************************************************************************/
+static inline void removeFromBound(jobsBound & remaining, const jobsBound & job){
+    remaining.weight -= job.weight;
+    remaining.lastMachine -= job.lastMachine;
+    remaining.allMachines -= job.allMachines;
+}
+
+
+/**********************************************************************************/
+/**
+ * constructor of a cache that keeps the completion times of every job of a
+ * sequence on every machine, so that a neighbour which shares the first
+ * positions with the cached sequence only needs to be evaluated from the first
+ * changed position onward.
+ * @param instance the instance the sequences belong to
+ * @param objective the objective function to compute
+ */
+/**********************************************************************************/
+CompletionTimesCache::CompletionTimesCache(PfspInstance & instance, Objective objective){
+    this->instance = &instance;
+    this->objective = objective;
+    this->nbrOfMachines = instance.getNbrOfMachines();
+
+    // select the kernel specialised for the shape of the instance, if any
+    switch(nbrOfMachines){
+        case 3: this->evaluationKernel = &CompletionTimesCache::runKernel<3>; break;
+        case 5: this->evaluationKernel = &CompletionTimesCache::runKernel<5>; break;
+        case 10: this->evaluationKernel = &CompletionTimesCache::runKernel<10>; break;
+        case 20: this->evaluationKernel = &CompletionTimesCache::runKernel<20>; break;
+        default: this->evaluationKernel = &CompletionTimesCache::runKernel<0>;
+    }
+    this->sequence = {0};
+    this->completionTimes.assign(nbrOfMachines, 0);
+    this->prefixObjectives = {0};
+    this->prefixBounds = {{0, 0, 0}};
+    this->machineEndTimes.assign(nbrOfMachines, 0);
+
+    // the weighted completion times have no due dates
+    const int nbrOfJobs = instance.getNbrOfJobs();
+    this->jobBounds.assign(nbrOfJobs + 1, {0, 0, 0});
+    for(int job = 1; job <= nbrOfJobs; ++job){
+        const long int weight = instance.getPriority(job);
+        const long int dueDate = (objective == WEIGHTED_TARDINESS) ? instance.getDueDate(job) : 0;
+        const long int lastMachineTime = instance.getJobProcessTimes(job)[nbrOfMachines - 1];
+        jobBounds[job] = {
+            .weight = weight,
+            .lastMachine = weight * (lastMachineTime - dueDate),
+            .allMachines = weight * (instance.getSumOfProcessTimes(job) - dueDate)};
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * destructor
+ */
+/**********************************************************************************/
+CompletionTimesCache::~CompletionTimesCache(){
+}
+
+
+/**********************************************************************************/
+/**
+ * recomputes the cached rows from a given position up to the end of the
+ * cached sequence
+ * @param from the first position to recompute (must be at least 1)
+ */
+/**********************************************************************************/
+void CompletionTimesCache::computeRows(int from){
+    const int sequenceSize = sequence.size();
+    const long int* dueDates = instance->getDueDates();
+    const long int* priorities = instance->getPriorities();
+
+    for(int j = from; j < sequenceSize; ++j){
+        const int job = sequence[j];
+        const ProcessTime* processTimes = instance->getJobProcessTimes(job);
+        const long int* previousRow = &completionTimes[(j-1) * nbrOfMachines];
+        long int* row = &completionTimes[j * nbrOfMachines];
+
+        long int endTime = previousRow[0] + processTimes[0];
+        row[0] = endTime;
+        for(int m = 1; m < nbrOfMachines; ++m){
+            endTime = std::max(endTime, previousRow[m]) + processTimes[m];
+            row[m] = endTime;
+        }
+        prefixObjectives[j] = prefixObjectives[j-1] + 
+            computeJobObjective(objective, endTime, dueDates[job], priorities[job]);
+
+        const jobsBound & bound = jobBounds[job];
+        prefixBounds[j] = {
+            .weight = prefixBounds[j-1].weight + bound.weight,
+            .lastMachine = prefixBounds[j-1].lastMachine + bound.lastMachine,
+            .allMachines = prefixBounds[j-1].allMachines + bound.allMachines};
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * sets the cached sequence. Only the positions from the first position that
+ * differs from the previously cached sequence are recomputed.
+ * @param sol the new sequence prefixed with the dummy job 0
+ */
+/**********************************************************************************/
+void CompletionTimesCache::setSequence(const vector<int> & sol){
+    const int from = getFirstDifference(sol);
+    sequence = sol;
+    completionTimes.resize(sol.size() * nbrOfMachines);
+    prefixObjectives.resize(sol.size());
+    prefixBounds.resize(sol.size());
+    computeRows(from);
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the cached sequence
+ */
+/**********************************************************************************/
+const vector<int> & CompletionTimesCache::getSequence(){
+    return sequence;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the objective of the complete cached sequence
+ */
+/**********************************************************************************/
+long int CompletionTimesCache::getObjective(){
+    return prefixObjectives.back();
+}
+
+
+/**********************************************************************************/
+/**
+ * @param position a position in the cached sequence
+ * @return the objective of the jobs up to and including the given position
+ */
+/**********************************************************************************/
+long int CompletionTimesCache::getPrefixObjective(int position){
+    return prefixObjectives[position];
+}
+
+
+/**********************************************************************************/
+/**
+ * @param position a position in the cached sequence
+ * @return pointer to the end times of the job at the given position on every machine
+ */
+/**********************************************************************************/
+const long int* CompletionTimesCache::getCompletionTimes(int position){
+    return &completionTimes[position * nbrOfMachines];
+}
+
+
+/**********************************************************************************/
+/**
+ * finds the first position where a sequence differs from the cached sequence
+ * @param sol the sequence to compare with the cached sequence
+ * @return the first differing position, or the size of the shortest sequence
+ *         if one is a prefix of the other
+ */
+/**********************************************************************************/
+int CompletionTimesCache::getFirstDifference(const vector<int> & sol){
+    const int size = std::min(sol.size(), sequence.size());
+    int j = 1;
+    while(j < size && sol[j] == sequence[j]) ++j;
+    return j;
+}
+
+
+/**********************************************************************************/
+/**
+ * evaluation kernel that schedules an optional first job followed by a range of
+ * jobs, starting from the given end times. When a cutoff is given, the kernel
+ * stops as soon as the objective of the scheduled jobs plus a lower bound for
+ * the remaining jobs exceeds the cutoff.
+ * @tparam FIXED_MACHINES the number of machines known at compile time, the end
+ *                        times are then kept in a fixed size array, or 0 for
+ *                        the generic kernel
+ * @param startEndTimes the end times on every machine before the first job
+ * @param firstJob a job to schedule before the range, or 0 if there is none
+ * @param jobs the range of jobs to schedule
+ * @param count the number of jobs in the range
+ * @param result the objective of the jobs scheduled before startEndTimes
+ * @param remaining the bound sums over the jobs in the range
+ * @param cutoff the objective above which the exact value is not needed
+ * @param pruned optional flag set when the evaluation was stopped early
+ * @return the objective of the complete sequence or, when pruned, a lower bound 
+ *         above the cutoff
+ */
+/**********************************************************************************/
+template <int FIXED_MACHINES>
+long int CompletionTimesCache::runKernel(const long int* startEndTimes, int firstJob, const int* jobs, int count,
+                                         long int result, jobsBound remaining, long int cutoff, bool* pruned){
+    const long int* dueDates = instance->getDueDates();
+    const long int* priorities = instance->getPriorities();
+
+    std::array<long int, (FIXED_MACHINES > 0) ? FIXED_MACHINES : 1> fixedEndTimes;
+    long int* endTimes = (FIXED_MACHINES > 0) ? fixedEndTimes.data() : machineEndTimes.data();
+    std::copy_n(startEndTimes, nbrOfMachines, endTimes);
+
+    long int endTime = 0;
+    if(firstJob > 0){
+        endTime = scheduleJob<FIXED_MACHINES>(endTimes, instance->getJobProcessTimes(firstJob), nbrOfMachines);
+        result += computeJobObjective(objective, endTime, dueDates[firstJob], priorities[firstJob]);
+    }
+
+    for(int k = 0; k < count; ++k){
+        // check the bound after every scheduled job but the last, whose result is exact anyway
+        if(cutoff != NO_CUTOFF && (k > 0 || firstJob > 0)){
+            const long int bound = result + computeRemainingBound(remaining, endTimes[0], endTime);
+            if(bound > cutoff){
+                if(pruned) *pruned = true;
+                return bound;
+            }
+        }
+
+        const int job = jobs[k];
+        endTime = scheduleJob<FIXED_MACHINES>(endTimes, instance->getJobProcessTimes(job), nbrOfMachines);
+        result += computeJobObjective(objective, endTime, dueDates[job], priorities[job]);
+        removeFromBound(remaining, jobBounds[job]);
+    }
+    if(pruned) *pruned = false;
+    return result;
+}
+
+
+/**********************************************************************************/
+/**
+ * evaluates a sequence that shares the positions before "from" with the cached
+ * sequence. The recurrence starts from the cached end times of position from-1.
+ * When a cutoff is given, the evaluation stops as soon as the objective of the
+ * scheduled jobs plus a lower bound for the remaining jobs exceeds the cutoff.
+ * @param sol the sequence to evaluate prefixed with the dummy job 0, containing 
+ *            the same jobs as the cached sequence
+ * @param from the first position in which sol may differ from the cached sequence
+ * @param cutoff the objective above which the exact value is not needed
+ * @param pruned optional flag set when the evaluation was stopped early
+ * @return the objective of sol or, when pruned, a lower bound above the cutoff
+ */
+/**********************************************************************************/
+long int CompletionTimesCache::evaluate(const vector<int> & sol, int from, long int cutoff, bool* pruned){
+    jobsBound remaining = prefixBounds.back();
+    removeFromBound(remaining, prefixBounds[from-1]);
+
+    return (this->*evaluationKernel)(&completionTimes[(from-1) * nbrOfMachines], 0, sol.data() + from, sol.size() - from,
+                                     prefixObjectives[from-1], remaining, cutoff, pruned);
+}
+
+
+/**********************************************************************************/
+/**
+ * evaluates the cached (partial) sequence with one extra job inserted at a given
+ * position. The head of the cached sequence up to the insertion position is
+ * reused, only the inserted job and the jobs behind it are recomputed. 
+ * A cutoff can be given as in evaluate.
+ * @param job the job to insert
+ * @param position the position the job gets in the resulting sequence, between
+ *                 1 and the size of the cached sequence (appending the job)
+ * @param cutoff the objective above which the exact value is not needed
+ * @param pruned optional flag set when the evaluation was stopped early
+ * @return the objective of the resulting sequence or, when pruned, a lower
+ *         bound above the cutoff
+ */
+/**********************************************************************************/
+long int CompletionTimesCache::evaluateInsertion(int job, int position, long int cutoff, bool* pruned){
+    jobsBound remaining = prefixBounds.back();
+    removeFromBound(remaining, prefixBounds[position-1]);
+
+    return (this->*evaluationKernel)(&completionTimes[(position-1) * nbrOfMachines], job, 
+                                     sequence.data() + position, sequence.size() - position,
+                                     prefixObjectives[position-1], remaining, cutoff, pruned);
+}
+
+/**********************************************************************************/
+/**
+ * evaluates all positions in which a job can be inserted in the cached (partial)
+ * sequence in one sweep. All positions share the head of the cached sequence.
+ * @param job the job to insert
+ * @param objectives vector in which the objective of inserting the job at every
+ *                   position is stored (index 0 is not used)
+ */
+/**********************************************************************************/
+void CompletionTimesCache::evaluateAllInsertions(int job, vector<long int> & objectives){
+    const int sequenceSize = sequence.size();
+    objectives.resize(sequenceSize + 1);
+    objectives[0] = 0;
+    for(int position = 1; position <= sequenceSize; ++position)
+        objectives[position] = evaluateInsertion(job, position);
+}
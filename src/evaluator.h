@@ -0,0 +1,78 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM                                                                              
+/* headerfile for evaluator.cpp
+/********************************************************************************/
+#ifndef _EVALUATOR_H_
+#define _EVALUATOR_H_
+
+#include <vector>
+#include <limits>
+
+#include "pfspinstance.h"
+
+using std::vector;
+
+// objective functions the evaluators can compute
+enum Objective {WEIGHTED_TARDINESS, WEIGHTED_COMPLETION_TIMES};
+
+// cutoff used when an evaluation must not be aborted
+const long int NO_CUTOFF = std::numeric_limits<long int>::max();
+
+// sums over a set of jobs used to bound the objective of the jobs that are not
+// scheduled yet: the sum of the weights, and the sums of w*(p_last - d) and
+// w*(p_total - d) which bound the completion time of every remaining job by the 
+// end time on the last and the first machine respectively
+struct jobsBound{
+    long int weight;
+    long int lastMachine;
+    long int allMachines;
+};
+
+
+// class definition
+class CompletionTimesCache{
+    private:
+        PfspInstance* instance;
+        Objective objective;
+        int nbrOfMachines;
+
+        // the cached sequence (prefixed with the dummy job 0), the end times of
+        // the job at every position on every machine (one row per position) and
+        // the objective of the first j jobs of the sequence
+        vector<int> sequence;
+        vector<long int> completionTimes;
+        vector<long int> prefixObjectives;
+        vector<jobsBound> prefixBounds;
+
+        // the bound terms of every job, indexed by job number
+        vector<jobsBound> jobBounds;
+
+        // machine end times used while evaluating a neighbour
+        vector<long int> machineEndTimes;
+
+        void computeRows(int from);
+
+        // evaluation kernel selected for the number of machines of the instance
+        template <int FIXED_MACHINES>
+        long int runKernel(const long int* startEndTimes, int firstJob, const int* jobs, int count,
+                           long int result, jobsBound remaining, long int cutoff, bool* pruned);
+        long int (CompletionTimesCache::*evaluationKernel)(const long int*, int, const int*, int, 
+                                                           long int, jobsBound, long int, bool*);
+
+    public:
+        CompletionTimesCache(PfspInstance & instance, Objective objective = WEIGHTED_TARDINESS);
+        ~CompletionTimesCache();
+
+        void setSequence(const vector<int> & sol);
+        const vector<int> & getSequence();
+        long int getObjective();
+        long int getPrefixObjective(int position);
+        const long int* getCompletionTimes(int position);
+        int getFirstDifference(const vector<int> & sol);
+
+        long int evaluate(const vector<int> & sol, int from, long int cutoff = NO_CUTOFF, bool* pruned = nullptr);
+        long int evaluateInsertion(int job, int position, long int cutoff = NO_CUTOFF, bool* pruned = nullptr);
+        void evaluateAllInsertions(int job, vector<long int> & objectives);
+};
+
+#endif
@@ -76,23 +76,49 @@ void FileHandler::saveHeaderToFile(){
     
     string columns = "file,";
     columns += "objectiveScore,";
+    columns += "lowerBound,";
     columns += "duration (ms),";
     columns += "max duration (ms),";
+    columns += "overshoot (ms),";
+    columns += "timeBudget,";
+    columns += "timeLimit,";
+    columns += "evaluationsPerSecond,";
     columns += "memorytype,";
     columns += "memorysize,";
     columns += "memoryretrievals,";
+    columns += "memorymisses,";
+    columns += "memoryevictions,";
+    columns += "memorybytes,";
+    columns += "memoryfalsepositiverate,";
+    columns += "memorydecisions,";
     columns += "initSolution,";
     columns += "neighbourhood,";
     columns += "pivotRule,";
     columns += "annealDecay,";
     columns += "annealLimit,";
+    columns += "cooling,";
     columns += "annealSteps,";
+    columns += "annealReheats,";
     columns += "initAnnealTemp,";
     columns += "finalAnnealTemp,";
     columns += "nbrOfPertubations,";
+    columns += "ilsAcceptance,";
+    columns += "destructionSize,";
+    columns += "tabuTenure,";
+    columns += "populationSize,";
+    columns += "crossover,";
+    columns += "nbrOfChains,";
+    columns += "migrationInterval,";
+    columns += "migrantAdoption,";
+    columns += "islandMix,";
+    columns += "migrantsReceived,";
+    columns += "migrantsAdopted,";
+    columns += "islands,";
+    columns += "relinking,";
     columns += "seed,";
     columns += "nbrOfNeighbourhoodsTested,";
     columns += "nbrOfNeighboursTested,";
+    columns += "nbrOfNeighboursPruned,";
     columns += "sequence";
     
     resultfile << columns << endl;
@@ -124,16 +150,36 @@ void FileHandler::save_result_to_file(solverResult solution, Configuration confi
     str += ",";
     str += std::to_string(solution.objectiveScore);
     str += ",";
+    str += std::to_string(solution.lowerBound);
+    str += ",";
     str += std::to_string(solution.duration);
     str += ",";
     str += std::to_string(solution.durationLimit);
     str += ",";
+    str += std::to_string(solution.overshoot);
+    str += ",";
+    str += TIME_BUDGET_STRINGS[configuration.getTimeBudget()];
+    str += ",";
+    str += std::to_string(configuration.getTimeLimit());
+    str += ",";
+    str += std::to_string(solution.evaluationsPerSecond);
+    str += ",";
     str += SOLVER_MEMORY_STRINGS[configuration.getSolverMemory()];
     str += ",";
     str += std::to_string(solution.memorySize);
     str += ",";
     str += std::to_string(solution.memoryRetrievals);
     str += ",";
+    str += std::to_string(solution.memoryMisses);
+    str += ",";
+    str += std::to_string(solution.memoryEvictions);
+    str += ",";
+    str += std::to_string(solution.memoryBytes);
+    str += ",";
+    str += std::to_string(solution.memoryFalsePositiveRate);
+    str += ",";
+    str += solution.memoryDecisions;
+    str += ",";
     str += INIT_SOLUTION_STRINGS[configuration.getInitSolution()];
     str += ",";
     str += NEIGHBOURHOOD_STRINGS[configuration.getNeighbourhood()];
@@ -144,20 +190,52 @@ void FileHandler::save_result_to_file(solverResult solution, Configuration confi
     str += ",";
     str += std::to_string(configuration.getAnnealingLimit());
     str += ",";
+    str += COOLING_STRINGS[configuration.getCooling()];
+    str += ",";
     str += std::to_string(solution.annealingSteps);
     str += ",";
+    str += std::to_string(solution.annealingReheats);
+    str += ",";
     str += std::to_string(solution.initAnnealingTemp);
     str += ",";
     str += std::to_string(solution.finalAnnealingTemp);
     str += ",";
     str += std::to_string(configuration.getPertubationValue());
     str += ",";
+    str += ILS_ACCEPTANCE_STRINGS[configuration.getIlsAcceptance()];
+    str += ",";
+    str += std::to_string(configuration.getDestructionSize());
+    str += ",";
+    str += std::to_string(configuration.getTabuTenure());
+    str += ",";
+    str += std::to_string(configuration.getPopulationSize());
+    str += ",";
+    str += CROSSOVER_STRINGS[configuration.getCrossover()];
+    str += ",";
+    str += std::to_string(configuration.getNbrOfChains());
+    str += ",";
+    str += std::to_string(configuration.getMigrationInterval());
+    str += ",";
+    str += MIGRANT_ADOPTION_STRINGS[configuration.getMigrantAdoption()];
+    str += ",";
+    str += ISLAND_MIX_STRINGS[configuration.getIslandMix()];
+    str += ",";
+    str += std::to_string(solution.migrantsReceived);
+    str += ",";
+    str += std::to_string(solution.migrantsAdopted);
+    str += ",";
+    str += solution.islandStatistics;
+    str += ",";
+    str += solution.relinkingStatistics;
+    str += ",";
     str += std::to_string(configuration.getSeed());
     str += ",";
     str += std::to_string(solution.neighbourhoodsTested);
     str += ",";
     str += std::to_string(solution.neighboursTested);
     str += ",";
+    str += std::to_string(solution.neighboursPruned);
+    str += ",";
     str += vectorToString(solution.sequence);
     
     
@@ -0,0 +1,356 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM                                                                              
+/* file contains a flat set associative table with a byte budget, used as solver
+/* memory. When the budget is reached, entries are evicted following the CLOCK
+/* algorithm within their bucket: every slot has a referenced bit that is set on
+/* a hit, the clock hand clears the bits it passes and evicts the first entry 
+/* without one.
+/********************************************************************************/
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include "flatmemory.h"
+
+#include "neighbourhood.h"
+
+using std::vector;
+
+
+/**********************************************************************************/
+/**
+ * constructor of an empty table
+ * @param nbrOfJobs the number of jobs in the stored solutions
+ * @param byteBudget the maximal number of bytes used by the buckets, at least
+ *                   one bucket is allocated
+ */
+/**********************************************************************************/
+FlatMemoryTable::FlatMemoryTable(int nbrOfJobs, long int byteBudget){
+    this->nbrOfJobs = nbrOfJobs;
+    this->jobIdBytes = (nbrOfJobs < 256) ? 1 : 2;
+    this->byteBudget = byteBudget;
+    this->evictions = 0;
+
+    long int nbrOfBuckets = INITIAL_FLAT_MEMORY_BUCKETS;
+    while(nbrOfBuckets > 1 && nbrOfBuckets * getBucketBytes() > byteBudget) nbrOfBuckets /= 2;
+    allocate(nbrOfBuckets);
+}
+
+
+/**********************************************************************************/
+/**
+ * destructor
+ */
+/**********************************************************************************/
+FlatMemoryTable::~FlatMemoryTable(){
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the number of bytes used by one bucket with its keys and clock hand
+ */
+/**********************************************************************************/
+long int FlatMemoryTable::getBucketBytes(){
+    return FLAT_MEMORY_BUCKET_SIZE * (sizeof(slotInfo) + static_cast<long int>(nbrOfJobs) * jobIdBytes) + 1;
+}
+
+
+/**********************************************************************************/
+/**
+ * one of the two buckets in which a hash can be stored. The low bits of the 
+ * permutation hashes of the neighbours of one solution are correlated, the 
+ * multiplication spreads the high bits over the buckets.
+ * @param hash the permutation hash
+ * @param choice 0 or 1 for the first or the second bucket
+ * @return the bucket
+ */
+/**********************************************************************************/
+long int FlatMemoryTable::getBucket(std::uint64_t hash, int choice){
+    const std::uint64_t multiplier = choice ? 0xc2b2ae3d27d4eb4fULL : 0x9e3779b97f4a7c15ULL;
+    return ((hash * multiplier) >> 32) & mask;
+}
+
+
+/**********************************************************************************/
+/**
+ * finds an empty slot for a hash in the emptiest of its two buckets
+ * @param hash the permutation hash
+ * @return the empty slot or NOT_FOUND when both buckets are full
+ */
+/**********************************************************************************/
+long int FlatMemoryTable::findEmptySlot(std::uint64_t hash){
+    long int emptySlot = NOT_FOUND;
+    int mostEmpty = 0;
+    for(int choice = 0; choice < 2; ++choice){
+        const long int first = getBucket(hash, choice) * FLAT_MEMORY_BUCKET_SIZE;
+        int empty = 0;
+        long int slot = NOT_FOUND;
+        for(long int current = first; current < first + FLAT_MEMORY_BUCKET_SIZE; ++current){
+            if(!slots[current].occupied){
+                ++empty;
+                slot = current;
+            }
+        }
+        if(empty > mostEmpty){
+            mostEmpty = empty;
+            emptySlot = slot;
+        }
+    }
+    return emptySlot;
+}
+
+
+/**********************************************************************************/
+/**
+ * replaces the table by an empty table
+ * @param nbrOfBuckets the number of buckets, a power of two
+ */
+/**********************************************************************************/
+void FlatMemoryTable::allocate(long int nbrOfBuckets){
+    slots.assign(nbrOfBuckets * FLAT_MEMORY_BUCKET_SIZE, slotInfo{0, 0, false, false, false});
+    keys.assign(nbrOfBuckets * FLAT_MEMORY_BUCKET_SIZE * nbrOfJobs * jobIdBytes, 0);
+    clockHands.assign(nbrOfBuckets, 0);
+    mask = nbrOfBuckets - 1;
+    nbrOfEntries = 0;
+}
+
+
+/**********************************************************************************/
+/**
+ * changes the number of buckets and reinserts all entries in the emptiest of their
+ * two buckets in the new table. An entry whose two new buckets are both full is 
+ * evicted and counted as an eviction, which mostly happens when the table shrinks
+ * but can also happen when it grows.
+ * @param nbrOfBuckets the new number of buckets, a power of two
+ */
+/**********************************************************************************/
+void FlatMemoryTable::resize(long int nbrOfBuckets){
+    vector<slotInfo> oldSlots;
+    vector<std::uint8_t> oldKeys;
+    oldSlots.swap(slots);
+    oldKeys.swap(keys);
+    const long int keyBytes = static_cast<long int>(nbrOfJobs) * jobIdBytes;
+
+    allocate(nbrOfBuckets);
+    for(long int oldSlot = 0; oldSlot < oldSlots.size(); ++oldSlot){
+        if(!oldSlots[oldSlot].occupied) continue;
+        const long int slot = findEmptySlot(oldSlots[oldSlot].hash);
+        if(slot == NOT_FOUND){
+            ++evictions;
+            continue;
+        }
+        slots[slot] = oldSlots[oldSlot];
+        std::copy_n(oldKeys.begin() + oldSlot * keyBytes, keyBytes, keys.begin() + slot * keyBytes);
+        ++nbrOfEntries;
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * frees a slot of a full bucket. The clock hand of the bucket clears the referenced
+ * bits it passes and evicts the first entry without one.
+ * @param bucket the bucket
+ * @return the freed slot
+ */
+/**********************************************************************************/
+long int FlatMemoryTable::evictFromBucket(long int bucket){
+    const long int first = bucket * FLAT_MEMORY_BUCKET_SIZE;
+    std::uint8_t & hand = clockHands[bucket];
+    while(slots[first + hand].referenced){
+        slots[first + hand].referenced = false;
+        hand = (hand + 1) % FLAT_MEMORY_BUCKET_SIZE;
+    }
+    const long int slot = first + hand;
+    hand = (hand + 1) % FLAT_MEMORY_BUCKET_SIZE;
+    slots[slot].occupied = false;
+    --nbrOfEntries;
+    ++evictions;
+    return slot;
+}
+
+
+/**********************************************************************************/
+/**
+ * stores the neighbour obtained by applying a move to a sequence as key of a slot
+ * @param slot the slot
+ * @param sequence the solution the move applies to
+ * @param move the move
+ */
+/**********************************************************************************/
+void FlatMemoryTable::writeKey(long int slot, const vector<int> & sequence, const Move & move){
+    const long int offset = slot * nbrOfJobs * jobIdBytes;
+    for(int p = 1; p <= nbrOfJobs; ++p){
+        const int job = getJobAfterMove(sequence, move, p);
+        if(jobIdBytes == 1) keys[offset + p - 1] = job;
+        else{
+            keys[offset + 2 * (p - 1)] = job & 0xff;
+            keys[offset + 2 * (p - 1) + 1] = job >> 8;
+        }
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * compares the key of a slot with the neighbour obtained by applying a move to
+ * a sequence
+ * @param slot the slot
+ * @param sequence the solution the move applies to
+ * @param move the move
+ * @return true if the slot contains the neighbour
+ */
+/**********************************************************************************/
+bool FlatMemoryTable::matchesKey(long int slot, const vector<int> & sequence, const Move & move){
+    const long int offset = slot * nbrOfJobs * jobIdBytes;
+    for(int p = 1; p <= nbrOfJobs; ++p){
+        const int job = getJobAfterMove(sequence, move, p);
+        const int stored = (jobIdBytes == 1) ? keys[offset + p - 1]
+                         : keys[offset + 2 * (p - 1)] | (keys[offset + 2 * (p - 1) + 1] << 8);
+        if(stored != job) return false;
+    }
+    return true;
+}
+
+
+/**********************************************************************************/
+/**
+ * looks up the neighbour obtained by applying a move to a sequence, a found entry 
+ * is marked as referenced
+ * @param hash the permutation hash of the neighbour
+ * @param sequence the solution the move applies to
+ * @param move the move
+ * @return the slot of the neighbour or NOT_FOUND
+ */
+/**********************************************************************************/
+long int FlatMemoryTable::find(std::uint64_t hash, const vector<int> & sequence, const Move & move){
+    for(int choice = 0; choice < 2; ++choice){
+        const long int first = getBucket(hash, choice) * FLAT_MEMORY_BUCKET_SIZE;
+        for(long int slot = first; slot < first + FLAT_MEMORY_BUCKET_SIZE; ++slot){
+            if(slots[slot].occupied && slots[slot].hash == hash && matchesKey(slot, sequence, move)){
+                slots[slot].referenced = true;
+                return slot;
+            }
+        }
+    }
+    return NOT_FOUND;
+}
+
+
+/**********************************************************************************/
+/**
+ * @param slot a slot returned by find
+ * @return the objective score stored in the slot
+ */
+/**********************************************************************************/
+long int FlatMemoryTable::getObjectiveScore(long int slot){
+    return slots[slot].objectiveScore;
+}
+
+
+/**********************************************************************************/
+/**
+ * @param slot a slot returned by find
+ * @return true if the stored objective score is a lower bound
+ */
+/**********************************************************************************/
+bool FlatMemoryTable::getIsLowerBound(long int slot){
+    return slots[slot].isLowerBound;
+}
+
+
+/**********************************************************************************/
+/**
+ * replaces the objective score stored in a slot
+ * @param slot a slot returned by find
+ * @param objectiveScore the new objective score
+ * @param isLowerBound true if the new objective score is a lower bound
+ */
+/**********************************************************************************/
+void FlatMemoryTable::update(long int slot, long int objectiveScore, bool isLowerBound){
+    slots[slot].objectiveScore = objectiveScore;
+    slots[slot].isLowerBound = isLowerBound;
+}
+
+
+/**********************************************************************************/
+/**
+ * inserts a neighbour that is not in the table yet. The table grows when it is
+ * three quarters full as long as this fits in the byte budget. When both buckets
+ * of the neighbour are full, an entry of its first bucket is evicted.
+ * @param hash the permutation hash of the neighbour
+ * @param sequence the solution the move applies to
+ * @param move the move
+ * @param objectiveScore the objective score of the neighbour
+ * @param isLowerBound true if the objective score is a lower bound
+ */
+/**********************************************************************************/
+void FlatMemoryTable::insert(std::uint64_t hash, const vector<int> & sequence, const Move & move, 
+                             long int objectiveScore, bool isLowerBound){
+    if(nbrOfEntries >= static_cast<long int>(slots.size()) * 3 / 4 &&
+       static_cast<long int>(clockHands.size()) * 2 * getBucketBytes() <= byteBudget) resize(clockHands.size() * 2);
+
+    long int slot = findEmptySlot(hash);
+    if(slot == NOT_FOUND) slot = evictFromBucket(getBucket(hash, 0));
+
+    slots[slot] = slotInfo{hash, objectiveScore, true, isLowerBound, false};
+    writeKey(slot, sequence, move);
+    ++nbrOfEntries;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the number of stored neighbours
+ */
+/**********************************************************************************/
+long int FlatMemoryTable::size(){
+    return nbrOfEntries;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the number of bytes allocated for the slots and keys
+ */
+/**********************************************************************************/
+long int FlatMemoryTable::getBytes(){
+    return static_cast<long int>(clockHands.size()) * getBucketBytes();
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the number of evicted entries
+ */
+/**********************************************************************************/
+long int FlatMemoryTable::getEvictions(){
+    return evictions;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the maximal number of bytes used by the buckets
+ */
+/**********************************************************************************/
+long int FlatMemoryTable::getByteBudget(){
+    return byteBudget;
+}
+
+
+/**********************************************************************************/
+/**
+ * changes the byte budget. A larger budget lets the table grow on the following
+ * insertions, a smaller budget halves the table until it fits (keeping at least
+ * one bucket).
+ * @param byteBudget the new maximal number of bytes used by the buckets
+ */
+/**********************************************************************************/
+void FlatMemoryTable::setByteBudget(long int byteBudget){
+    this->byteBudget = byteBudget;
+    long int nbrOfBuckets = clockHands.size();
+    while(nbrOfBuckets > 1 && nbrOfBuckets * getBucketBytes() > byteBudget) nbrOfBuckets /= 2;
+    if(nbrOfBuckets != clockHands.size()) resize(nbrOfBuckets);
+}
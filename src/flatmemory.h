@@ -0,0 +1,77 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM                                                                              
+/* headerfile for flatmemory.cpp
+/********************************************************************************/
+#ifndef _FLATMEMORY_H_
+#define _FLATMEMORY_H_
+
+#include <vector>
+#include <cstdint>
+
+#include "neighbourhood.h"
+
+using std::vector;
+
+// result of a lookup when the neighbour is not in the table
+const long int NOT_FOUND = -1;
+
+// number of slots per bucket, the table starts with the given number of buckets
+// and doubles until the byte budget is reached
+const int FLAT_MEMORY_BUCKET_SIZE = 8;
+const long int INITIAL_FLAT_MEMORY_BUCKETS = 128;
+
+
+// class definition
+class FlatMemoryTable{
+    private:
+        // metadata of one slot, the key of the slot is stored separately
+        struct slotInfo{
+            std::uint64_t hash;
+            long int objectiveScore;
+            bool occupied;
+            bool isLowerBound;
+            bool referenced;
+        };
+
+        int nbrOfJobs;
+        int jobIdBytes;
+        long int byteBudget;
+
+        // set associative table: a neighbour is stored in the emptiest of the two
+        // buckets of its hash, every bucket has its own clock hand. The keys of all slots are
+        // stored in one array with the jobs at positions 1..nbrOfJobs as 8 bit
+        // (or 16 bit when there are more than 255 jobs) job ids
+        vector<slotInfo> slots;
+        vector<std::uint8_t> keys;
+        vector<std::uint8_t> clockHands;
+        long int mask;
+        long int nbrOfEntries;
+        long int evictions;
+
+        void allocate(long int nbrOfBuckets);
+        void resize(long int nbrOfBuckets);
+        long int evictFromBucket(long int bucket);
+        void writeKey(long int slot, const vector<int> & sequence, const Move & move);
+        bool matchesKey(long int slot, const vector<int> & sequence, const Move & move);
+        long int getBucketBytes();
+        long int getBucket(std::uint64_t hash, int choice);
+        long int findEmptySlot(std::uint64_t hash);
+
+    public:
+        FlatMemoryTable(int nbrOfJobs, long int byteBudget);
+        ~FlatMemoryTable();
+
+        long int find(std::uint64_t hash, const vector<int> & sequence, const Move & move);
+        long int getObjectiveScore(long int slot);
+        bool getIsLowerBound(long int slot);
+        void update(long int slot, long int objectiveScore, bool isLowerBound);
+        void insert(std::uint64_t hash, const vector<int> & sequence, const Move & move, long int objectiveScore, bool isLowerBound);
+
+        long int size();
+        long int getBytes();
+        long int getEvictions();
+        long int getByteBudget();
+        void setByteBudget(long int byteBudget);
+};
+
+#endif
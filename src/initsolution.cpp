@@ -12,6 +12,7 @@
 
 #include "pfspinstance.h"
 #include "helpers.h"
+#include "evaluator.h"
 
 using std::vector, std::endl;
 
@@ -106,30 +107,35 @@ vector<int> getSRZHeuristicInitSolution(PfspInstance pfspInstance,bool chooseRan
     vector <int> solution;
     solution.push_back(jobs[0].index);
     solution.push_back(jobs[1].index);
+
+    // the partial solution is cached so that all insertion positions of the next
+    // job are evaluated in one sweep over the shared head of the partial solution
+    CompletionTimesCache partialSolution(pfspInstance, WEIGHTED_COMPLETION_TIMES);
+    vector<long int> candidateWcts;
     
     for(i =2;i < nbrOfJobs+1;++i){
         int currentBestWct = std::numeric_limits<int>::max(); // set current best to max value
-        vector <int> currentBestCandidate;
+        int currentBestPosition = 0;
+        const int tempjob = jobs[i].index;
+
+        partialSolution.setSequence(solution);
+        partialSolution.evaluateAllInsertions(tempjob, candidateWcts);
         
         for(j = 1; j < solution.size() + 1; ++j){
-            vector<int>  candidate(solution); 
-                        
-            int tempjob = jobs[i].index;
-            candidate.insert(candidate.begin() + j,tempjob);
-            int candidateWct = pfspInstance.computeWeightedCompletionTimes(candidate);
+            int candidateWct = candidateWcts[j];
             
             if(chooseRandomWhenEqual){
                 if((candidateWct < currentBestWct) || ((candidateWct == currentBestWct) && ((rand() % 2) == 0))){
-                    currentBestCandidate = candidate;
+                    currentBestPosition = j;
                     currentBestWct = candidateWct;
                 }
             }
             else if(candidateWct <= currentBestWct){        
-                currentBestCandidate = candidate;
+                currentBestPosition = j;
                 currentBestWct = candidateWct;
             }
         }
-        solution = currentBestCandidate; 
+        solution.insert(solution.begin() + currentBestPosition, tempjob);
     }
     return solution;  
 }
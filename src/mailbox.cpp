@@ -0,0 +1,77 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* file contains the mailbox through which a search that runs as an island sends
+/* its best solution to the next island. A mailbox has one sender and one receiver
+/* and holds the last migrant sent. It is a sequence lock: the sender never waits,
+/* it makes the sequence number odd while it writes and even again when the migrant
+/* is complete. The receiver never waits either, it drops a migrant that was
+/* overwritten while it was read, the next migrant replaces it anyway.
+/********************************************************************************/
+#include <vector>
+#include <atomic>
+#include <memory>
+
+#include "mailbox.h"
+
+#include "helpers.h"
+
+
+/**********************************************************************************/
+/**
+ * constructor, the mailbox starts empty
+ * @param size the size of the solutions sent through the mailbox
+ */
+/**********************************************************************************/
+Mailbox::Mailbox(int size): sequence(0), objectiveScore(0), solution(new std::atomic<int>[size]){
+    this->size = size;
+    this->lastReceived = 0;
+    for(int i = 0; i < size; ++i) solution[i].store(0, std::memory_order_relaxed);
+}
+
+
+/**********************************************************************************/
+/**
+ * destructor
+ */
+/**********************************************************************************/
+Mailbox::~Mailbox(){
+}
+
+
+/**********************************************************************************/
+/**
+ * replaces the migrant in the mailbox, must only be called by the sender
+ * @param objectiveScore the score of the migrant
+ * @param solution the migrant, of the size of the mailbox
+ */
+/**********************************************************************************/
+void Mailbox::send(long int objectiveScore, const vector<int> & solution){
+    if(static_cast<int>(solution.size()) != size) generateError("ERROR. file:mailbox.cpp, method:send. the solution does not fit the mailbox");
+    const unsigned long current = sequence.load(std::memory_order_relaxed);
+    sequence.store(current + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    this->objectiveScore.store(objectiveScore, std::memory_order_relaxed);
+    for(int i = 0; i < size; ++i) this->solution[i].store(solution[i], std::memory_order_relaxed);
+    sequence.store(current + 2, std::memory_order_release);
+}
+
+
+/**********************************************************************************/
+/**
+ * takes the migrant out of the mailbox, must only be called by the receiver
+ * @param objectiveScore set to the score of the migrant
+ * @param solution set to the migrant, undefined when no migrant is received
+ * @return true if a complete migrant arrived since the last one received
+ */
+/**********************************************************************************/
+bool Mailbox::receive(long int & objectiveScore, vector<int> & solution){
+    const unsigned long before = sequence.load(std::memory_order_acquire);
+    if(before == lastReceived || before % 2 == 1) return false;
+    objectiveScore = this->objectiveScore.load(std::memory_order_relaxed);
+    solution.resize(size);
+    for(int i = 0; i < size; ++i) solution[i] = this->solution[i].load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if(sequence.load(std::memory_order_relaxed) != before) return false;
+    lastReceived = before;
+    return true;
+}
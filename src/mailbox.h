@@ -0,0 +1,35 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* headerfile for mailbox.cpp
+/********************************************************************************/
+#ifndef _MAILBOX_H_
+#define _MAILBOX_H_
+
+#include <vector>
+#include <atomic>
+#include <memory>
+
+using std::vector;
+
+
+// class definition
+class Mailbox{
+    private:
+        // even while no migrant is being written, odd while one is
+        std::atomic<unsigned long> sequence;
+        std::atomic<long int> objectiveScore;
+        std::unique_ptr<std::atomic<int>[]> solution;
+        int size;
+
+        // sequence number of the last migrant received, only used by the receiver
+        unsigned long lastReceived;
+
+    public:
+        Mailbox(int size);
+        ~Mailbox();
+
+        void send(long int objectiveScore, const vector<int> & solution);
+        bool receive(long int & objectiveScore, vector<int> & solution);
+};
+
+#endif
@@ -4,15 +4,31 @@
 /********************************************************************************/
 #include <string>
 #include <filesystem>
+#include <csignal>
 
 #include "constants.h"
 #include "configuration.h"
 #include "configparser.h"
 #include "helpers.h"
 #include "runners.h" 
+#include "deadline.h"
 
 namespace fs = std::filesystem;
 
+/**********************************************************************************/
+/**
+ * handles the first interrupt (ctrl-c) by cancelling all deadlines, so that the
+ * running searches stop with their best solution and the results are still saved.
+ * A second interrupt terminates the program.
+ * @param signal the number of the signal
+ */
+/**********************************************************************************/
+void handleInterrupt(int signal){
+    cancelAllDeadlines();
+    std::signal(SIGINT, SIG_DFL);
+}
+
+
 /**********************************************************************************/
 /**
  * launches the program based on the command line parameters given
@@ -22,6 +38,8 @@ int main(int argc, char *argv[]) {
 
     string errorString;
     
+    std::signal(SIGINT, handleInterrupt);
+
     // run test on one file if first parameter is a file
     if(argc>1 && fs::is_regular_file(argv[1])){
         Configuration configuration = parseToConfiguration(argc,argv);
@@ -31,6 +49,8 @@ int main(int argc, char *argv[]) {
     // else run test on all files in directory
     else if(argc>1 && fs::is_directory(argv[1])){
         SolverMemory solverMemory = NONE;
+        TimeBudget timeBudget = WALL;
+        float timeLimit = DEFAULT_TIME_LIMIT;
         
         // select memoization
         if(argc>3){
@@ -38,28 +58,50 @@ int main(int argc, char *argv[]) {
             if(solverMemoryString.compare("NONE")==0) solverMemory = NONE;
             else if(solverMemoryString.compare("HASH")==0) solverMemory = HASH;
             else if(solverMemoryString.compare("MAP")==0) solverMemory = MAP;
+            else if(solverMemoryString.compare("FLAT")==0) solverMemory = FLAT;
+            else if(solverMemoryString.compare("BLOOM")==0) solverMemory = BLOOM;
+            else if(solverMemoryString.compare("ADAPTIVE")==0) solverMemory = ADAPTIVE;
             else generateError("third command line parameter is not a valid solver memory");
         }
 
+        // select the unit of the time limit and the time limit
+        if(argc>4){
+            string timeBudgetString = argv[4];
+            if(timeBudgetString.compare("WALL")==0) timeBudget = WALL;
+            else if(timeBudgetString.compare("CPU")==0) timeBudget = CPU;
+            else if(timeBudgetString.compare("NM")==0) timeBudget = NM;
+            else if(timeBudgetString.compare("EVALS")==0) timeBudget = EVALS;
+            else if(timeBudgetString.compare("EVALSNM")==0) timeBudget = EVALSNM;
+            else generateError("fourth command line parameter is not a valid unit of the time limit");
+        }
+        if(argc>5){
+            string timeLimitString = argv[5];
+            if(isFloatNumber(timeLimitString) && std::stof(timeLimitString) >= 0) timeLimit = std::stof(timeLimitString);
+            else generateError("fifth command line parameter is not a valid time limit");
+        }
+        if((timeBudget == EVALS || timeBudget == EVALSNM) && timeLimit == 0)
+            generateError("a budget of evaluations needs a positive limit as fifth command line parameter");
+
         // select testtype
         if(argc>2){
             string testType = argv[2];
             if(testType.compare("NONVND")==0){
-                runAllTestsInFolder(argv[1],solverMemory, NBR_OF_ITERATIONS);
+                runAllTestsInFolder(argv[1],solverMemory,timeBudget,timeLimit,NBR_OF_ITERATIONS);
             }
             else if(testType.compare("TEI")==0){
-                runVNDTestsInFolder(argv[1],TEI,solverMemory,NBR_OF_ITERATIONS);
+                runVNDTestsInFolder(argv[1],TEI,solverMemory,timeBudget,timeLimit,NBR_OF_ITERATIONS);
             }
             else if(testType.compare("TIE")==0){
-                runVNDTestsInFolder(argv[1],TIE,solverMemory,NBR_OF_ITERATIONS);
+                runVNDTestsInFolder(argv[1],TIE,solverMemory,timeBudget,timeLimit,NBR_OF_ITERATIONS);
             }
-            else if(testType.compare("ANNEAL")==0 || testType.compare("PERTUB")==0){
-                runAnnealPertubationTestsInFolder(argv[1],testType,solverMemory,NBR_OF_ITERATIONS);
+            else if(testType.compare("ANNEAL")==0 || testType.compare("SA")==0 || testType.compare("IG")==0 || testType.compare("PERTUB")==0 ||
+                    testType.compare("TS")==0 || testType.compare("GA")==0 || testType.compare("ISLANDS")==0){
+                runAnnealPertubationTestsInFolder(argv[1],testType,solverMemory,timeBudget,timeLimit,NBR_OF_ITERATIONS);
             }
             else generateError("second command line parameter is not a valid test type");
         }
         else{
-            runAllTestsInFolder(argv[1],solverMemory,NBR_OF_ITERATIONS);
+            runAllTestsInFolder(argv[1],solverMemory,timeBudget,timeLimit,NBR_OF_ITERATIONS);
         }
     }
 
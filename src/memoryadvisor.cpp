@@ -0,0 +1,217 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* file contains the advisor of the ADAPTIVE solver memory. Per neighbourhood type
+/* it samples the hit rate of the memory, the time a lookup costs and the time an
+/* evaluation costs. A lookup pays off when the evaluation time it saves on average
+/* (hit rate times evaluation time) exceeds its own time. The memory is switched
+/* off for the neighbourhood types where it does not pay off and those types are
+/* probed again later. While it pays off and entries get evicted, the byte budget
+/* of the memory grows. Every decision is logged.
+/********************************************************************************/
+#include <string>
+#include <sstream>
+#include <algorithm>
+
+#include "memoryadvisor.h"
+
+#include "configuration.h"
+
+using std::string;
+
+
+/**********************************************************************************/
+/**
+ * constructor, the memory starts active for every neighbourhood type
+ * @param initialByteBudget the byte budget the memory starts with
+ * @param maximalByteBudget the byte budget the memory may grow to
+ */
+/**********************************************************************************/
+MemoryAdvisor::MemoryAdvisor(long int initialByteBudget, long int maximalByteBudget){
+    this->maximalByteBudget = maximalByteBudget;
+    this->initialByteBudget = std::min(initialByteBudget, maximalByteBudget);
+    this->byteBudget = this->initialByteBudget;
+    this->evictionsAtLastDecision = 0;
+    this->totalLookups = 0;
+    this->currentType = TRANSPOSE;
+    for(neighbourhoodStatistics & current : statistics){
+        current.active = true;
+        current.probing = false;
+        current.scansUntilProbe = 0;
+        current.probeInterval = ADAPTIVE_MEMORY_FIRST_PROBE;
+        resetStatistics(current);
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * destructor
+ */
+/**********************************************************************************/
+MemoryAdvisor::~MemoryAdvisor(){
+}
+
+
+/**********************************************************************************/
+/**
+ * clears the measurements of a neighbourhood type
+ * @param current the statistics of the neighbourhood type
+ */
+/**********************************************************************************/
+void MemoryAdvisor::resetStatistics(neighbourhoodStatistics & current){
+    current.lookups = 0;
+    current.hits = 0;
+    current.timedLookups = 0;
+    current.timedMisses = 0;
+    current.lookupNanoseconds = 0;
+    current.evaluationNanoseconds = 0;
+}
+
+
+/**********************************************************************************/
+/**
+ * called at the start of the scan of a neighbourhood. A neighbourhood type without
+ * memory is probed again when its number of scans without memory is reached.
+ * @param type TRANSPOSE, EXCHANGE or INSERT
+ * @return true if the memory is used during the scan
+ */
+/**********************************************************************************/
+bool MemoryAdvisor::startScan(Neigbourhood type){
+    currentType = type;
+    neighbourhoodStatistics & current = statistics[type];
+    if(!current.active && --current.scansUntilProbe <= 0){
+        current.active = true;
+        current.probing = true;
+        resetStatistics(current);
+    }
+    return current.active;
+}
+
+
+/**********************************************************************************/
+/**
+ * records a lookup of the neighbourhood type of the current scan and decides
+ * when enough lookups are recorded
+ * @param hit true if the score was retrieved from the memory
+ * @param timed true if the lookup was timed
+ * @param lookupNanoseconds the time spent in the memory
+ * @param evaluationNanoseconds the time spent evaluating the neighbour on a miss
+ * @param evictions the total number of evictions of the memory
+ * @return true if the byte budget changed
+ */
+/**********************************************************************************/
+bool MemoryAdvisor::recordLookup(bool hit, bool timed, double lookupNanoseconds, double evaluationNanoseconds,
+                                 long int evictions){
+    neighbourhoodStatistics & current = statistics[currentType];
+    ++totalLookups;
+    ++current.lookups;
+    if(hit) ++current.hits;
+    if(timed){
+        ++current.timedLookups;
+        current.lookupNanoseconds += lookupNanoseconds;
+        if(!hit){
+            ++current.timedMisses;
+            current.evaluationNanoseconds += evaluationNanoseconds;
+        }
+    }
+    if(current.lookups < ADAPTIVE_MEMORY_WINDOW) return false;
+
+    const long int previousByteBudget = byteBudget;
+    decide(evictions);
+    return byteBudget != previousByteBudget;
+}
+
+
+/**********************************************************************************/
+/**
+ * decides for the neighbourhood type of the current scan whether the memory pays
+ * off and whether its byte budget changes. Only changes are logged.
+ * @param evictions the total number of evictions of the memory
+ */
+/**********************************************************************************/
+void MemoryAdvisor::decide(long int evictions){
+    neighbourhoodStatistics & current = statistics[currentType];
+    const double hitRate = static_cast<double>(current.hits) / current.lookups;
+    const double lookupTime = current.timedLookups ? current.lookupNanoseconds / current.timedLookups : 0;
+    const double evaluationTime = current.timedMisses ? current.evaluationNanoseconds / current.timedMisses : 0;
+    const double saving = hitRate * evaluationTime - lookupTime;
+
+    // without a timed miss (nearly) every lookup was a hit
+    const bool paysOff = current.timedMisses == 0 || saving > 0;
+
+    std::ostringstream decision;
+    decision.precision(3);
+    if(paysOff && current.probing){
+        decision << totalLookups << " " << NEIGHBOURHOOD_STRINGS[currentType] << " on";
+        current.probeInterval = ADAPTIVE_MEMORY_FIRST_PROBE;
+    }
+    if(!paysOff){
+        if(!current.probing){
+            decision << totalLookups << " " << NEIGHBOURHOOD_STRINGS[currentType] << " off";
+            current.probeInterval = ADAPTIVE_MEMORY_FIRST_PROBE;
+        }
+        else current.probeInterval = std::min(current.probeInterval * 2, ADAPTIVE_MEMORY_LAST_PROBE);
+        current.active = false;
+        current.scansUntilProbe = current.probeInterval;
+    }
+    if(!decision.str().empty())
+        decision << " (hit rate " << hitRate << " saving " << saving << " ns)";
+
+    // while the memory pays off, entries that get evicted could have been hits
+    bool budgetChanged = false;
+    if(paysOff && evictions > evictionsAtLastDecision && byteBudget < maximalByteBudget){
+        byteBudget = std::min(byteBudget * 2, maximalByteBudget);
+        budgetChanged = true;
+    }
+
+    // when no neighbourhood type uses the memory anymore, it shrinks to its initial budget
+    if(!paysOff && byteBudget > initialByteBudget &&
+       !statistics[TRANSPOSE].active && !statistics[EXCHANGE].active && !statistics[INSERT].active){
+        byteBudget = initialByteBudget;
+        budgetChanged = true;
+    }
+    if(budgetChanged){
+        if(!decision.str().empty()) decision << "; ";
+        decision << totalLookups << " budget " << byteBudget / 1024 << " kB";
+    }
+
+    if(!decision.str().empty()){
+        if(!decisions.empty()) decisions += "; ";
+        decisions += decision.str();
+    }
+    current.probing = false;
+    evictionsAtLastDecision = evictions;
+    resetStatistics(current);
+}
+
+
+/**********************************************************************************/
+/**
+ * @param type TRANSPOSE, EXCHANGE or INSERT
+ * @return true if the memory is used for the neighbourhood type
+ */
+/**********************************************************************************/
+bool MemoryAdvisor::isActive(Neigbourhood type){
+    return statistics[type].active;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the byte budget the memory should use
+ */
+/**********************************************************************************/
+long int MemoryAdvisor::getByteBudget(){
+    return byteBudget;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the decisions separated by semicolons, every decision starts with the
+ *         number of lookups after which it was taken
+ */
+/**********************************************************************************/
+string MemoryAdvisor::getDecisions(){
+    return decisions;
+}
@@ -0,0 +1,77 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* headerfile for memoryadvisor.cpp
+/********************************************************************************/
+#ifndef _MEMORYADVISOR_H_
+#define _MEMORYADVISOR_H_
+
+#include <string>
+
+#include "configuration.h"
+
+using std::string;
+
+// number of lookups of a neighbourhood type after which is decided whether the memory
+// pays off for it, one in ADAPTIVE_MEMORY_TIMING_INTERVAL lookups is timed
+const long int ADAPTIVE_MEMORY_WINDOW = 4096;
+const long int ADAPTIVE_MEMORY_TIMING_INTERVAL = 16;
+
+// a neighbourhood type without memory is tried again after a number of scans that
+// doubles every time the memory still does not pay off
+const long int ADAPTIVE_MEMORY_FIRST_PROBE = 8;
+const long int ADAPTIVE_MEMORY_LAST_PROBE = 4096;
+
+// byte budget the memory starts with, it doubles up to the configured budget while
+// the memory pays off and entries get evicted
+const long int ADAPTIVE_MEMORY_INITIAL_BUDGET = 4 * 1024 * 1024;
+
+
+// class definition
+class MemoryAdvisor{
+    private:
+        // measurements of one neighbourhood type since its last decision
+        struct neighbourhoodStatistics{
+            bool active;
+            bool probing;
+            long int lookups;
+            long int hits;
+            long int timedLookups;
+            long int timedMisses;
+            double lookupNanoseconds;
+            double evaluationNanoseconds;
+            long int scansUntilProbe;
+            long int probeInterval;
+        };
+
+        // statistics of TRANSPOSE, EXCHANGE and INSERT
+        neighbourhoodStatistics statistics[3];
+        Neigbourhood currentType;
+        long int initialByteBudget;
+        long int maximalByteBudget;
+        long int byteBudget;
+        long int evictionsAtLastDecision;
+        long int totalLookups;
+        string decisions;
+
+        void resetStatistics(neighbourhoodStatistics & current);
+        void decide(long int evictions);
+
+    public:
+        MemoryAdvisor(long int initialByteBudget, long int maximalByteBudget);
+        ~MemoryAdvisor();
+
+        bool startScan(Neigbourhood type);
+
+        // one in ADAPTIVE_MEMORY_TIMING_INTERVAL lookups of a neighbourhood type is timed
+        inline bool isTimedLookup(){
+            return (statistics[currentType].lookups % ADAPTIVE_MEMORY_TIMING_INTERVAL) == 0;
+        }
+        bool recordLookup(bool hit, bool timed, double lookupNanoseconds, double evaluationNanoseconds, 
+                          long int evictions);
+
+        bool isActive(Neigbourhood type);
+        long int getByteBudget();
+        string getDecisions();
+};
+
+#endif
@@ -3,12 +3,129 @@
 /* file contains functions to create neighbourhoods
 /********************************************************************************/
 #include <vector>
+#include <algorithm>
 
 #include "neighbourhood.h"
 
+#include "configuration.h"
+
 using std::vector, std::begin, std::end;;
 
 
+/*************************************************************************/
+/**
+ * constructor of a generator containing all moves of a neighbourhood type
+ * for solutions with the given number of jobs. The moves only depend on the
+ * number of jobs, so that one generator serves every solution, and are 
+ * ordered in the same way as the neighbours of the neighbourhood functions.
+ * @param type the neighbourhood type (TRANSPOSE, EXCHANGE or INSERT)
+ * @param nbrOfJobs the number of jobs in the solutions
+ */
+/*************************************************************************/
+MoveGenerator::MoveGenerator(Neigbourhood type, int nbrOfJobs){
+    int i,j;
+    this->type = type;
+
+    if(type == TRANSPOSE){
+        for ( i = 1; i < nbrOfJobs; ++i )
+            moves.push_back({type, i, i+1});
+    }
+    else if(type == EXCHANGE || type == INSERT){
+        for ( i = 1; i < nbrOfJobs; ++i )
+            for(j = i+1; j <= nbrOfJobs; ++j)
+                moves.push_back({type, i, j});
+    }
+}
+
+
+/*************************************************************************/
+/**
+ * destructor
+ */
+/*************************************************************************/
+MoveGenerator::~MoveGenerator(){
+}
+
+
+/*************************************************************************/
+/**
+ * @return the neighbourhood type of the moves
+ */
+/*************************************************************************/
+Neigbourhood MoveGenerator::getType(){
+    return type;
+}
+
+
+/*************************************************************************/
+/**
+ * @return the number of moves and thus neighbours in the neighbourhood
+ */
+/*************************************************************************/
+int MoveGenerator::size(){
+    return moves.size();
+}
+
+
+/*************************************************************************/
+/**
+ * @return pointer to the moves in their generation order
+ */
+/*************************************************************************/
+const Move* MoveGenerator::data(){
+    return moves.data();
+}
+
+
+/*************************************************************************/
+/**
+ * applies a move in place on a solution
+ * @param solution the solution to change
+ * @param move the move to apply
+ */
+/*************************************************************************/
+void applyMove(vector<int> &solution, const Move &move){
+    if(move.type == INSERT) applyMove<INSERT>(solution, move);
+    else applyMove<EXCHANGE>(solution, move);
+}
+
+
+/*************************************************************************/
+/**
+ * undoes a move that was applied in place on a solution
+ * @param solution the solution to restore
+ * @param move the move to undo
+ */
+/*************************************************************************/
+void undoMove(vector<int> &solution, const Move &move){
+    if(move.type == INSERT) undoMove<INSERT>(solution, move);
+    else undoMove<EXCHANGE>(solution, move);
+}
+
+
+/*************************************************************************/
+/**
+ * creates the neighbourhood of a solution by applying every move of a
+ * generator to a copy of the solution
+ * @param solution the solution prefixed with 0 at index 0
+ * @param type the neighbourhood type
+ * @return vector<vector<int>> neighbourhood of the solution
+ */
+/*************************************************************************/
+static vector<vector<int>> materialiseNeighbourhood(vector<int> &solution, Neigbourhood type){
+    MoveGenerator moves(type, solution.size() - 1);
+    vector<vector<int>> neighbourhood;
+    neighbourhood.reserve(moves.size());
+
+    for(int i = 0; i < moves.size(); ++i){
+        vector<int> neighbour(solution);
+        applyMove(neighbour, moves[i]);
+        neighbourhood.push_back(neighbour);
+    }
+    return neighbourhood;
+}
+
+
 /*************************************************************************/
 /**
  * function to create a neighbourhood of a given a solution
@@ -20,18 +137,7 @@ using std::vector, std::begin, std::end;;
  */
 /*************************************************************************/
 vector<vector<int>> neighbourhoodTranspose(vector<int> &solution){
-    int i,j,tempjob;
-    const int nbrJobs = solution.size() -1;
-    vector<vector<int>> neighbourhood;
-    
-    for ( i = 1; i < nbrJobs; ++i ){
-        vector<int> neighbour(solution); 
-        tempjob = neighbour[i];
-        neighbour[i] = neighbour[i+1];
-        neighbour[i+1] = tempjob;
-        neighbourhood.push_back(neighbour);
-    }   
-    return neighbourhood;
+    return materialiseNeighbourhood(solution, TRANSPOSE);
 }
 
 
@@ -46,21 +152,7 @@ vector<vector<int>> neighbourhoodTranspose(vector<int> &solution){
  */
 /*************************************************************************/
 vector<vector<int>> neighbourhoodExchange(vector<int> &solution){
-    int i,j,tempjob;
-    const int nbrJobs = solution.size() -1;
-    vector<vector<int>> neighbourhood;
-    
-    for ( i = 1; i < nbrJobs; ++i ){
-        for(j = i+1; j <= nbrJobs; ++j){
-            vector<int> neighbour(solution); 
-            int tempjob = neighbour[i];
-            neighbour[i] = neighbour[j];
-            neighbour[j] = tempjob;
-
-            neighbourhood.push_back(neighbour);
-        }   
-    }
-return neighbourhood;
+    return materialiseNeighbourhood(solution, EXCHANGE);
 }
 
 
@@ -75,21 +167,5 @@ return neighbourhood;
  */
 /*************************************************************************/
 vector<vector<int>> neighbourhoodInsert(vector<int> &solution){
-    int i,j,tempjob;
-    const int nbrJobs = solution.size() -1;
-    vector<vector<int>> neighbourhood;
-    
-    for ( i = 1; i < nbrJobs; ++i ){
-        for(j = i+1; j <= nbrJobs; ++j){
-            vector<int> neighbour(solution); 
-            
-            // store in tempjob and erase first to prevent increasing vector size
-            int tempjob = neighbour[i];
-            neighbour.erase(neighbour.begin()+ i);
-            neighbour.insert(neighbour.begin() + j,tempjob);
-            
-            neighbourhood.push_back(neighbour);
-        }
-    }   
-    return neighbourhood;
-}
\ No newline at end of file
+    return materialiseNeighbourhood(solution, INSERT);
+}
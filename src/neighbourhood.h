@@ -6,10 +6,97 @@
 #define _NEIGHBOURHOOD_H_
 
 #include <vector>
+#include <algorithm>
+
+#include "configuration.h"
 
 using std::vector;
 
+// a move turns a solution into one of its neighbours. For TRANSPOSE and EXCHANGE
+// the jobs at positions first and second are swapped, for INSERT the job at 
+// position first is removed and reinserted at position second. first is always
+// the smallest position, and thus the first position that changes.
+struct Move{
+    Neigbourhood type;
+    int first;
+    int second;
+};
+
+
+// class definition
+class MoveGenerator{
+    private:
+        Neigbourhood type;
+        vector<Move> moves;
+
+    public:
+        MoveGenerator(Neigbourhood type, int nbrOfJobs);
+        ~MoveGenerator();
+
+        Neigbourhood getType();
+        int size();
+        const Move* data();
+        inline const Move & operator[](int index) const { return moves[index]; }
+};
+
+void applyMove(vector<int> &solution, const Move &move);
+void undoMove(vector<int> &solution, const Move &move);
+
+
+/*************************************************************************/
+/**
+ * applies a move of a neighbourhood type known at compile time in place
+ * @param solution the solution to change
+ * @param move the move to apply, of neighbourhood type TYPE
+ */
+/*************************************************************************/
+template<Neigbourhood TYPE>
+inline void applyMove(vector<int> &solution, const Move &move){
+    if(TYPE == INSERT)
+        std::rotate(solution.begin() + move.first, solution.begin() + move.first + 1, solution.begin() + move.second + 1);
+    else
+        std::swap(solution[move.first], solution[move.second]);
+}
+
+
+/*************************************************************************/
+/**
+ * undoes a move of a neighbourhood type known at compile time in place
+ * @param solution the solution to restore
+ * @param move the move to undo, of neighbourhood type TYPE
+ */
+/*************************************************************************/
+template<Neigbourhood TYPE>
+inline void undoMove(vector<int> &solution, const Move &move){
+    if(TYPE == INSERT)
+        std::rotate(solution.begin() + move.first, solution.begin() + move.second, solution.begin() + move.second + 1);
+    else
+        std::swap(solution[move.first], solution[move.second]);
+}
+
+
+/*************************************************************************/
+/**
+ * returns the job at a given position of the neighbour obtained by applying
+ * a move to a solution, without constructing the neighbour
+ * @param solution the solution the move applies to
+ * @param move the move to apply
+ * @param position the position in the neighbour
+ * @return the job at the given position in the neighbour
+ */
+/*************************************************************************/
+inline int getJobAfterMove(const vector<int> &solution, const Move &move, int position){
+    if(position < move.first || position > move.second) return solution[position];
+    if(move.type == INSERT){
+        if(position == move.second) return solution[move.first];
+        return solution[position + 1];
+    }
+    if(position == move.first) return solution[move.second];
+    if(position == move.second) return solution[move.first];
+    return solution[position];
+}
+
 vector<vector<int>> neighbourhoodTranspose(vector<int> &solution);
 vector<vector<int>> neighbourhoodExchange(vector<int> &solution);
 vector<vector<int>> neighbourhoodInsert(vector<int> &solution);
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,136 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM                                                                              
+/* file contains a permutation hash that can be updated in constant time for
+/* the moves of the neighbourhoods
+/********************************************************************************/
+#include <vector>
+#include <cstdint>
+
+#include "permutationhash.h"
+
+#include "neighbourhood.h"
+
+using std::vector;
+
+
+/**********************************************************************************/
+/**
+ * splitmix64 generator, used for the keys so that they do not depend on (and do 
+ * not consume numbers from) the random generators of the solver
+ * @param state the state of the generator, advanced by the call
+ * @return the next pseudo random number
+ */
+/**********************************************************************************/
+static std::uint64_t nextKey(std::uint64_t & state){
+    std::uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+
+/**********************************************************************************/
+/**
+ * constructor, draws the keys of the jobs and the multiplier
+ * @param nbrOfJobs the number of jobs in the permutations to hash
+ */
+/**********************************************************************************/
+PermutationHash::PermutationHash(int nbrOfJobs){
+    std::uint64_t state = 0x5eed;
+    jobKeys.resize(nbrOfJobs + 1);
+    for(std::uint64_t & key : jobKeys) key = nextKey(state);
+
+    // an odd multiplier has an inverse modulo 2^64, found by Newton iteration
+    const std::uint64_t multiplier = nextKey(state) | 1;
+    inverseMultiplier = multiplier;
+    for(int i = 0; i < 5; ++i) inverseMultiplier *= 2 - multiplier * inverseMultiplier;
+
+    powers.resize(nbrOfJobs + 1);
+    powers[0] = 1;
+    for(int p = 1; p <= nbrOfJobs; ++p) powers[p] = powers[p-1] * multiplier;
+}
+
+
+/**********************************************************************************/
+/**
+ * destructor
+ */
+/**********************************************************************************/
+PermutationHash::~PermutationHash(){
+}
+
+
+/**********************************************************************************/
+/**
+ * computes the hash of a solution from scratch
+ * @param solution the solution prefixed with job 0
+ * @return the hash of the solution
+ */
+/**********************************************************************************/
+std::uint64_t PermutationHash::computeHash(const vector<int> & solution){
+    std::uint64_t hash = 0;
+    for(int p = 0; p < solution.size(); ++p) hash += jobKeys[solution[p]] * powers[p];
+    return hash;
+}
+
+
+/**********************************************************************************/
+/**
+ * sets the sequence the neighbour hashes are derived from
+ * @param solution the solution prefixed with job 0
+ */
+/**********************************************************************************/
+void PermutationHash::setSequence(const vector<int> & solution){
+    sequence = solution;
+    prefixHashes.resize(solution.size());
+    std::uint64_t hash = 0;
+    for(int p = 0; p < solution.size(); ++p){
+        hash += jobKeys[solution[p]] * powers[p];
+        prefixHashes[p] = hash;
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the sequence the neighbour hashes are derived from
+ */
+/**********************************************************************************/
+const vector<int> & PermutationHash::getSequence(){
+    return sequence;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the hash of the sequence
+ */
+/**********************************************************************************/
+std::uint64_t PermutationHash::getHash(){
+    return prefixHashes.back();
+}
+
+
+/**********************************************************************************/
+/**
+ * computes the hash of the neighbour obtained by applying a move to the sequence
+ * in constant time
+ * @param move the move to apply
+ * @return the hash of the neighbour
+ */
+/**********************************************************************************/
+std::uint64_t PermutationHash::getNeighbourHash(const Move & move){
+    const int first = move.first;
+    const int second = move.second;
+    const std::uint64_t firstKey = jobKeys[sequence[first]];
+
+    if(move.type == INSERT){
+        // the jobs after first up to second move one position forward, which divides
+        // their contribution by the multiplier, the first job moves to second
+        const std::uint64_t shifted = prefixHashes[second] - prefixHashes[first];
+        return prefixHashes.back() - shifted + shifted * inverseMultiplier
+               - firstKey * powers[first] + firstKey * powers[second];
+    }
+    const std::uint64_t secondKey = jobKeys[sequence[second]];
+    return prefixHashes.back() + (secondKey - firstKey) * powers[first] + (firstKey - secondKey) * powers[second];
+}
@@ -0,0 +1,45 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM                                                                              
+/* headerfile for permutationhash.cpp
+/********************************************************************************/
+#ifndef _PERMUTATIONHASH_H_
+#define _PERMUTATIONHASH_H_
+
+#include <vector>
+#include <cstdint>
+
+#include "neighbourhood.h"
+
+using std::vector;
+
+// position aware hash of a permutation: the sum over all positions p of
+// key(job at p) * multiplier^p (modulo 2^64). Because the multiplier is odd and 
+// thus invertible, the hash of every TRANSPOSE, EXCHANGE and INSERT neighbour
+// follows in constant time from the hash of the solution.
+
+// class definition
+class PermutationHash{
+    private:
+        // a random key per job, the powers of the multiplier per position and
+        // the inverse of the multiplier
+        vector<std::uint64_t> jobKeys;
+        vector<std::uint64_t> powers;
+        std::uint64_t inverseMultiplier;
+
+        // the sequence the neighbour hashes are derived from and the hashes of 
+        // its prefixes (the sum up to and including a position)
+        vector<int> sequence;
+        vector<std::uint64_t> prefixHashes;
+
+    public:
+        PermutationHash(int nbrOfJobs);
+        ~PermutationHash();
+
+        std::uint64_t computeHash(const vector<int> & solution);
+        void setSequence(const vector<int> & solution);
+        const vector<int> & getSequence();
+        std::uint64_t getHash();
+        std::uint64_t getNeighbourHash(const Move & move);
+};
+
+#endif
@@ -23,7 +23,6 @@
 #include <fstream>
 #include <cmath>
 #include <string>
-#include <numeric>
 #include <algorithm>
 
 #include "pfspinstance.h"
@@ -63,13 +62,39 @@ PfspInstance::~PfspInstance()
 /* : */
 void PfspInstance::allowMatrixMemory(int nbJ, int nbM)
 {
-    processingTimesMatrix.resize(nbJ+1);          // 1st dimension
+    // pad the rows to a multiple of a cache line
+    const int valuesPerLine = AlignedAllocator<ProcessTime>::alignment / sizeof(ProcessTime);
+    machineStride = ((nbM + valuesPerLine - 1) / valuesPerLine) * valuesPerLine;
+    jobStride = ((nbJ + 1 + valuesPerLine - 1) / valuesPerLine) * valuesPerLine;
+
+    jobMajorProcessTimes.assign(static_cast<std::size_t>(nbJ+1) * machineStride, 0);
+    machineMajorProcessTimes.assign(static_cast<std::size_t>(nbM) * jobStride, 0);
+
+    dueDates.assign(nbJ+1, 0);
+    priority.assign(nbJ+1, 0);
+    sumOfProcessTimes.assign(nbJ+1, 0);
+    weightedSumOfProcessTimes.assign(nbJ+1, 0);
+}
+
 
-    for (int cpt = 0; cpt < nbJ+1; ++cpt)
-        processingTimesMatrix[cpt].resize(nbM+1); // 2nd dimension
+/**********************************************************************************/
+/**
+ * aux method to precompute the per job data (sum of the processing times and
+ * the WSPT ratio) once the complete instance is read
+ */
+/**********************************************************************************/
+void PfspInstance::computeJobData()
+{
+    for (int j = 1; j <= nbrOfJobs; ++j)
+    {
+        const ProcessTime* processTimes = getJobProcessTimes(j);
+        long int sum = 0;
+        for (int m = 0; m < nbrOfMachines; ++m)
+            sum += processTimes[m];
 
-    dueDates.resize(nbJ+1);
-    priority.resize(nbJ+1);
+        sumOfProcessTimes[j] = sum;
+        weightedSumOfProcessTimes[j] = static_cast<double>(sum) / priority[j];
+    }
 }
 
 
@@ -121,7 +146,8 @@ bool PfspInstance::readDataFromFile(string fileName,bool verbose)
 				fileIn >> readValue; // The number of each machine, not important !
 				fileIn >> readValue; // Process Time
 
-				processingTimesMatrix[j][m] = readValue;
+				jobMajorProcessTimes[static_cast<std::size_t>(j) * machineStride + m - 1] = readValue;
+				machineMajorProcessTimes[static_cast<std::size_t>(m - 1) * jobStride + j] = readValue;
 			}
 		}
         fileIn >> str; // this is not read
@@ -135,6 +161,7 @@ bool PfspInstance::readDataFromFile(string fileName,bool verbose)
 			fileIn >> readValue;
             priority[j] = readValue;
 		}
+        computeJobData();
 
         if (verbose) cout << "All is read from file." << std::endl;
 		fileIn.close();
@@ -215,7 +242,7 @@ long int PfspInstance::getProcessTime(int job, int machine)
         std::cout << "ERROR. file:pfspInstance.cpp, method:getProcessTime. Out of bound. job=" << job
             << ", machine=" << machine << std::endl;
 
-        return processingTimesMatrix[job][machine];
+        return getJobProcessTimes(job)[machine - 1];
     }
 }
 
@@ -232,7 +259,7 @@ long int PfspInstance::getSumOfProcessTimes(int job){
         if ((job < 1) || (job > nbrOfJobs))
         std::cout << "ERROR. file:pfspInstance.cpp, method:getSumOfProcessTimes. Out of bound. job=" << job << std::endl;
     
-        return std::accumulate(processingTimesMatrix[job].begin(), processingTimesMatrix[job].end(),0);
+        return sumOfProcessTimes[job];
     }
 
 }
@@ -244,63 +271,43 @@ long int PfspInstance::getSumOfProcessTimes(int job){
  */
 /**********************************************************************************/
 double PfspInstance::getWeightedSumOfProcessTimes(int job){
-    if (job == 0)
-        return 0;
-    else{
-        int sumOfProcessTimes = this->getSumOfProcessTimes(job);
-        int weight = this->getPriority(job);
-        return static_cast<double>(sumOfProcessTimes)/weight;
-    }
+    if ((job < 0) || (job > nbrOfJobs))
+        std::cout << "ERROR. file:pfspInstance.cpp, method:getWeightedSumOfProcessTimes. Out of bound. job=" << job << std::endl;
+
+    return weightedSumOfProcessTimes[job];
 };
 
 
 /**********************************************************************************/
 /**
- * 
+ * computes the completion time of every job of a solution on the last machine.
+ * The recurrence runs job by job over one contiguous row of the job-major table
+ * while the end times of the previous job on every machine are kept in a
+ * small buffer.
+ * @param sol the solution prefixed with the dummy job 0
+ * @return the completion times on the last machine, indexed by position
  */
 /**********************************************************************************/
 vector< long int > PfspInstance::computeCompletionTimes(vector< int > & sol)
 {
-	int j, m;
-	int jobNumber;
+	const int solSize = sol.size();
+	vector< long int > completionTimes(solSize, 0);
+	vector< long int > machineEndTimes(nbrOfMachines, 0);
 
-	/* We need end times on previous machine : */
-	vector< long int > previousMachineEndTime ( sol.size());
-	/* And the end time of the previous job, on the same machine : */
-	long int previousJobEndTime;
-    
-	/* 1st machine : */
-	previousMachineEndTime[0] = 0;
-	for ( j = 1; j < sol.size(); ++j )
+	for ( int j = 1; j < solSize; ++j )
 	{
-		jobNumber = sol[j];
-		previousMachineEndTime[j] = previousMachineEndTime[j-1] + processingTimesMatrix[jobNumber][1];
-	}
-   
-	for ( m = 2; m <= nbrOfMachines; ++m )
-	{
-		previousMachineEndTime[1] +=
-				processingTimesMatrix[sol[1]][m];
-		previousJobEndTime = previousMachineEndTime[1];
+		const ProcessTime* processTimes = getJobProcessTimes(sol[j]);
+		long int endTime = machineEndTimes[0] + processTimes[0];
+		machineEndTimes[0] = endTime;
 
-       
-		for ( j = 2; j < sol.size(); ++j )
+		for ( int m = 1; m < nbrOfMachines; ++m )
 		{
-            jobNumber = sol[j];
-            
-			if ( previousMachineEndTime[j] > previousJobEndTime )
-			{
-                previousMachineEndTime[j] = previousMachineEndTime[j] + processingTimesMatrix[jobNumber][m];
-				previousJobEndTime = previousMachineEndTime[j];   
-			}
-			else
-			{
-                previousJobEndTime += processingTimesMatrix[jobNumber][m];
-				previousMachineEndTime[j] = previousJobEndTime;
-			}
+			endTime = std::max(endTime, machineEndTimes[m]) + processTimes[m];
+			machineEndTimes[m] = endTime;
 		}
+		completionTimes[j] = endTime;
 	}
-    return previousMachineEndTime;
+	return completionTimes;
 };
 
 
@@ -322,18 +329,32 @@ long int PfspInstance::computeWeightedCompletionTimes(vector< int > & sol)
 	return wct;
 }
 
+
+/**********************************************************************************/
+/**
+ * computes the weighted tardiness of a given solution without materialising
+ * the completion times of all jobs
+ * @param sol the solution prefixed with the dummy job 0
+ * @return the weighted tardiness of the solution
+ */
+/**********************************************************************************/
 long int PfspInstance::computeSolutionTardiness(vector< int > & sol)
 {
-    int j;
+    const int solSize = sol.size();
     long int totalTardiness = 0;
-    vector< long int > previousMachineEndTime = this->computeCompletionTimes(sol);
-
-    for ( j = 1; j< sol.size(); ++j ){
-        long int jobDueDate = this->getDueDate(j);
-        long int jobCompletionDate = previousMachineEndTime[j];
-        long int jobPriority = this->getPriority(j);
-        totalTardiness += std::max(jobCompletionDate-jobDueDate, 0l)* jobPriority;
-
+    vector< long int > machineEndTimes(nbrOfMachines, 0);
+
+    for ( int j = 1; j < solSize; ++j ){
+        const int job = sol[j];
+        const ProcessTime* processTimes = getJobProcessTimes(job);
+        long int endTime = machineEndTimes[0] + processTimes[0];
+        machineEndTimes[0] = endTime;
+
+        for ( int m = 1; m < nbrOfMachines; ++m ){
+            endTime = std::max(endTime, machineEndTimes[m]) + processTimes[m];
+            machineEndTimes[m] = endTime;
+        }
+        totalTardiness += std::max(endTime - dueDates[job], 0l) * priority[job];
     }
     return totalTardiness;
 }
@@ -351,9 +372,9 @@ solutionMetrics PfspInstance::computeSolutionMetrics(vector< int > & sol){
         ct += completionTimes[j];
         wct += completionTimes[j] * priority[sol[j]];
 
-        long int jobDueDate = this->getDueDate(j);
+        long int jobDueDate = dueDates[sol[j]];
         long int jobCompletionDate = completionTimes[j];
-        long int jobPriority = this->getPriority(j);
+        long int jobPriority = priority[sol[j]];
         totalTardiness += std::max(jobCompletionDate-jobDueDate, 0l)* jobPriority;
 
     }
@@ -369,4 +390,3 @@ solutionMetrics PfspInstance::computeSolutionMetrics(vector< int > & sol){
 
     return metrics;
 }
-
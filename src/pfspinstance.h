@@ -24,9 +24,39 @@
 
 #include <string>
 #include <vector>
+#include <cstdint>
+#include <new>
 
 using std::vector, std::string;
 
+/* processing times are stored in a narrow integer type, the Taillard instances
+   never exceed two digits which keeps a 100x20 table well within the L1 cache */
+typedef std::int32_t ProcessTime;
+
+/* allocator used for the processing time tables so that every row starts on a
+   cache line boundary */
+template <typename T>
+struct AlignedAllocator{
+    typedef T value_type;
+    static const std::size_t alignment = 64;
+
+    AlignedAllocator() noexcept {}
+    template <typename U> AlignedAllocator(const AlignedAllocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n){
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignment)));
+    }
+    void deallocate(T* p, std::size_t) noexcept{
+        ::operator delete(p, std::align_val_t(alignment));
+    }
+};
+template <typename T, typename U>
+bool operator==(const AlignedAllocator<T>&, const AlignedAllocator<U>&) { return true; }
+template <typename T, typename U>
+bool operator!=(const AlignedAllocator<T>&, const AlignedAllocator<U>&) { return false; }
+
+typedef vector<ProcessTime, AlignedAllocator<ProcessTime>> ProcessTimesTable;
+
 struct solutionMetrics{
     vector<int> solution;
     vector<long int> completionTimes;
@@ -40,10 +70,24 @@ class PfspInstance{
     private:
         int nbrOfJobs;
         int nbrOfMachines;
+
+        /* row lengths of the flat tables, padded to a full cache line */
+        int machineStride;
+        int jobStride;
+
+        /* processing times stored job-major (one row of machines per job) and
+           machine-major (one row of jobs per machine). Machines are 0-based in
+           both tables, job 0 is the dummy job with all processing times 0 */
+        ProcessTimesTable jobMajorProcessTimes;
+        ProcessTimesTable machineMajorProcessTimes;
+
+        /* per job data, indexed by job number (index 0 is the dummy job) */
         std::vector< long int > dueDates;
         std::vector< long int > priority;
+        std::vector< long int > sumOfProcessTimes;
+        std::vector< double > weightedSumOfProcessTimes;
 
-        std::vector< vector <long int> > processingTimesMatrix;
+        void computeJobData();
 
     public:
         PfspInstance();
@@ -62,7 +106,16 @@ class PfspInstance{
         double getWeightedSumOfProcessTimes(int job);
         long int getDueDate(int job);
         long int getPriority(int job);
-    
+
+        /* unchecked access to the flat tables for the evaluation kernels : */
+        inline const ProcessTime* getJobProcessTimes(int job) const{
+            return jobMajorProcessTimes.data() + static_cast<std::size_t>(job) * machineStride;
+        }
+        inline const ProcessTime* getMachineProcessTimes(int machine) const{
+            return machineMajorProcessTimes.data() + static_cast<std::size_t>(machine - 1) * jobStride;
+        }
+        inline const long int* getDueDates() const { return dueDates.data(); }
+        inline const long int* getPriorities() const { return priority.data(); }
 
         /* Read Data from a file : */
         bool readDataFromFile(string fileName,bool verbose= false);
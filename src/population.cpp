@@ -0,0 +1,213 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* file contains the population of the memetic algorithm and its crossover and
+/* mutation operators. The solutions of all members are stored one after the other
+/* in one block of memory, every solution has the same width and starts with the
+/* dummy job 0, so that a member is a pointer into the block and the next
+/* generation replaces the population by swapping two blocks. The operators work
+/* on these pointers.
+/********************************************************************************/
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include "population.h"
+
+#include "configuration.h"
+#include "helpers.h"
+
+
+/**********************************************************************************/
+/**
+ * constructor, all members start as the identity permutation with score 0
+ * @param size the number of members
+ * @param nbrOfJobs the number of jobs of the instance
+ */
+/**********************************************************************************/
+Population::Population(int size, int nbrOfJobs){
+    if(size <= 0) generateError("ERROR. file:population.cpp, method:Population. a population needs members");
+    this->width = nbrOfJobs + 1;
+    this->size = size;
+    this->solutions.resize(static_cast<long int>(size) * width);
+    this->objectiveScores.assign(size, 0);
+    for(int member = 0; member < size; ++member)
+        for(int position = 0; position < width; ++position) solutions[static_cast<long int>(member) * width + position] = position;
+}
+
+
+/**********************************************************************************/
+/**
+ * destructor
+ */
+/**********************************************************************************/
+Population::~Population(){
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the number of members
+ */
+/**********************************************************************************/
+int Population::getSize(){
+    return size;
+}
+
+
+/**********************************************************************************/
+/**
+ * @param member the index of the member
+ * @return the solution of the member, the number of jobs plus one wide
+ */
+/**********************************************************************************/
+int* Population::getSolution(int member){
+    return solutions.data() + static_cast<long int>(member) * width;
+}
+
+
+/**********************************************************************************/
+/**
+ * @param member the index of the member
+ * @return the objective score of the member
+ */
+/**********************************************************************************/
+long int Population::getObjectiveScore(int member){
+    return objectiveScores[member];
+}
+
+
+/**********************************************************************************/
+/**
+ * replaces a member
+ * @param member the index of the member
+ * @param solution the new solution, the number of jobs plus one wide
+ * @param objectiveScore the score of the new solution
+ */
+/**********************************************************************************/
+void Population::setMember(int member, const int* solution, long int objectiveScore){
+    std::copy(solution, solution + width, getSolution(member));
+    objectiveScores[member] = objectiveScore;
+}
+
+
+/**********************************************************************************/
+/**
+ * @param member the index of the member
+ * @param solution a solution, the number of jobs plus one wide
+ * @return true if the member has the given solution
+ */
+/**********************************************************************************/
+bool Population::isEqual(int member, const int* solution){
+    return std::equal(solution, solution + width, getSolution(member));
+}
+
+
+/**********************************************************************************/
+/**
+ * exchanges the members with those of a population of the same size
+ * @param other the other population
+ */
+/**********************************************************************************/
+void Population::swap(Population & other){
+    if(other.width != width || other.size != size)
+        generateError("ERROR. file:population.cpp, method:swap. the populations differ in size");
+    solutions.swap(other.solutions);
+    objectiveScores.swap(other.objectiveScores);
+}
+
+
+/**********************************************************************************/
+/**
+ * combines two parents into a child.
+ * OX (order crossover) copies the positions between two cut points of the first
+ * parent and fills the other positions, from the second cut point on, with the
+ * missing jobs in the order of the second parent.
+ * PMX (partially mapped crossover) copies the positions between two cut points of
+ * the first parent and the other positions of the second parent, a job of the
+ * second parent that is already copied is replaced by the job the first parent
+ * maps it to.
+ * SJOX (similar job order crossover) copies the jobs that both parents have on the
+ * same position and the positions up to a cut point of the first parent, and fills
+ * the other positions with the missing jobs in the order of the second parent.
+ * @param type OX, PMX or SJOX
+ * @param first the first parent
+ * @param second the second parent
+ * @param child the child, of the same width as the parents
+ * @param nbrOfJobs the number of jobs of the instance
+ * @param generator the generator of the cut points
+ * @param scratch memory used by the operator
+ */
+/**********************************************************************************/
+void crossover(Crossover type, const int* first, const int* second, int* child, int nbrOfJobs,
+               std::mt19937 & generator, vector<int> & scratch){
+    std::uniform_int_distribution<int> positionDistribution(1, nbrOfJobs);
+    int cut = positionDistribution(generator);
+    int secondCut = positionDistribution(generator);
+    if(cut > secondCut) std::swap(cut, secondCut);
+    child[0] = 0;
+
+    if(type == PMX){
+        scratch.resize(nbrOfJobs + 1);
+        for(int position = 1; position <= nbrOfJobs; ++position) scratch[first[position]] = position;
+        for(int position = 1; position <= nbrOfJobs; ++position){
+            if(position >= cut && position <= secondCut){
+                child[position] = first[position];
+                continue;
+            }
+            int job = second[position];
+            while(scratch[job] >= cut && scratch[job] <= secondCut) job = second[scratch[job]];
+            child[position] = job;
+        }
+        return;
+    }
+
+    // the inherited jobs are marked, the other positions are filled in order
+    scratch.assign(nbrOfJobs + 1, 0);
+    if(type == OX){
+        for(int position = cut; position <= secondCut; ++position){
+            child[position] = first[position];
+            scratch[first[position]] = 1;
+        }
+        int position = secondCut % nbrOfJobs + 1;
+        for(int k = 0; k < nbrOfJobs; ++k){
+            const int job = second[(secondCut + k) % nbrOfJobs + 1];
+            if(scratch[job]) continue;
+            child[position] = job;
+            position = position % nbrOfJobs + 1;
+        }
+        return;
+    }
+
+    for(int position = 1; position <= nbrOfJobs; ++position){
+        child[position] = 0;
+        if(position <= cut || first[position] == second[position]){
+            child[position] = first[position];
+            scratch[first[position]] = 1;
+        }
+    }
+    int position = 1;
+    for(int k = 1; k <= nbrOfJobs; ++k){
+        if(scratch[second[k]]) continue;
+        while(child[position] != 0) ++position;
+        child[position] = second[k];
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * moves a random job to another random position
+ * @param solution the solution to mutate
+ * @param nbrOfJobs the number of jobs of the instance
+ * @param generator the generator of the positions
+ */
+/**********************************************************************************/
+void shiftMutation(int* solution, int nbrOfJobs, std::mt19937 & generator){
+    if(nbrOfJobs < 2) return;
+    std::uniform_int_distribution<int> positionDistribution(1, nbrOfJobs);
+    const int from = positionDistribution(generator);
+    int to = positionDistribution(generator);
+    while(to == from) to = positionDistribution(generator);
+    if(from < to) std::rotate(solution + from, solution + from + 1, solution + to + 1);
+    else std::rotate(solution + to, solution + from, solution + from + 1);
+}
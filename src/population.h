@@ -0,0 +1,42 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* headerfile for population.cpp
+/********************************************************************************/
+#ifndef _POPULATION_H_
+#define _POPULATION_H_
+
+#include <vector>
+#include <random>
+
+#include "configuration.h"
+
+using std::vector;
+
+
+// class definition
+class Population{
+    private:
+        // the solutions of all members one after the other, every solution prefixed
+        // with the dummy job 0
+        int width;
+        int size;
+        vector<int> solutions;
+        vector<long int> objectiveScores;
+
+    public:
+        Population(int size, int nbrOfJobs);
+        ~Population();
+
+        int getSize();
+        int* getSolution(int member);
+        long int getObjectiveScore(int member);
+        void setMember(int member, const int* solution, long int objectiveScore);
+        bool isEqual(int member, const int* solution);
+        void swap(Population & other);
+};
+
+void crossover(Crossover type, const int* first, const int* second, int* child, int nbrOfJobs,
+               std::mt19937 & generator, vector<int> & scratch);
+void shiftMutation(int* solution, int nbrOfJobs, std::mt19937 & generator);
+
+#endif
@@ -22,6 +22,7 @@
 #include "configparser.h"
 #include "solver.h"
 #include "fileio.h"
+#include "elitepool.h"
 
 using std::string, std::endl;
 using std::vector;
@@ -57,15 +58,28 @@ void runOneTest(Configuration configuration){
     std::cout << "best solution : ";
     printVector(result.sequence);
     std::cout << "objective function score: " << result.objectiveScore << endl;
+    std::cout << "proven lower bound: " << result.lowerBound << endl;
     std::cout << "duration (ms): " << result.duration << endl;
     std::cout << "max duration (ms): " << result.durationLimit << endl;
+    std::cout << "overshoot of max duration (ms): " << result.overshoot << endl;
+    std::cout << "evaluations per second: " << result.evaluationsPerSecond << endl;
     std::cout << "initial annealing temp : " << result.initAnnealingTemp << endl;
     std::cout << "final annealing temp : " << result.finalAnnealingTemp << endl;
     std::cout << "annealing steps: " << result.annealingSteps << endl;
+    std::cout << "annealing reheats: " << result.annealingReheats << endl;
     std::cout << "neighbours tested: " << result.neighboursTested << endl;
     std::cout << "neighbourhoods tested: " << result.neighbourhoodsTested << endl;
+    std::cout << "neighbours pruned against best score: " << result.neighboursPruned << endl;
     std::cout << "neighbours stored in memory: " << result.memorySize << endl;
     std::cout << "neighbours retrieved from memory: " << result.memoryRetrievals << endl;
+    std::cout << "neighbours missed in memory: " << result.memoryMisses << endl;
+    std::cout << "neighbours evicted from memory: " << result.memoryEvictions << endl;
+    std::cout << "bytes used by memory: " << result.memoryBytes << endl;
+    std::cout << "estimated false positive rate of memory: " << result.memoryFalsePositiveRate << endl;
+    std::cout << "memory decisions: " << result.memoryDecisions << endl;
+    std::cout << "migrants received: " << result.migrantsReceived << endl;
+    std::cout << "migrants adopted: " << result.migrantsAdopted << endl;
+    std::cout << "islands: " << result.islandStatistics << endl;
     printHorizontalLine();
 
     // save result in file
@@ -79,10 +93,12 @@ void runOneTest(Configuration configuration){
  * runs tests on multiple files
  * @param folder folder where the data files are stored
  * @param solverMemory solver memory to use
+ * @param timeBudget the unit of the time limit
+ * @param timeLimit the time limit, 0 for the default limit of the instance
  * @param nbrOfIterations the number of iterations to use
  */
 /**********************************************************************************/
-void runAllTestsInFolder(string folder,SolverMemory solverMemory,int nbrOfIterations){
+void runAllTestsInFolder(string folder,SolverMemory solverMemory,TimeBudget timeBudget,float timeLimit,int nbrOfIterations){
     string errorString;
     //check if directory is valid
     if(!fs::is_directory(folder)) {
@@ -144,6 +160,7 @@ void runAllTestsInFolder(string folder,SolverMemory solverMemory,int nbrOfIterat
                             PERTUBATION_VALUE_0,
                             true,
                             seed);
+                        configuration.setTimeLimit(timeBudget,timeLimit);
                         
                         // solve instance with 
                         solverResult result = solveSchedule(pfspInstance,configuration);
@@ -179,10 +196,12 @@ void runAllTestsInFolder(string folder,SolverMemory solverMemory,int nbrOfIterat
  * @param folder folder where the data files are stored
  * @param neighboorhoodMethod the specific neighboorhood method to use
  * @param solverMemory solver memory to use
+ * @param timeBudget the unit of the time limit
+ * @param timeLimit the time limit, 0 for the default limit of the instance
  * @param nbrOfIterations the number of iterations to use
  */
 /**********************************************************************************/
-void runVNDTestsInFolder(string folder,Neigbourhood neighboorhoodMethod,SolverMemory solverMemory,int nbrOfIterations){
+void runVNDTestsInFolder(string folder,Neigbourhood neighboorhoodMethod,SolverMemory solverMemory,TimeBudget timeBudget,float timeLimit,int nbrOfIterations){
     string errorString;
     //check if directory is valid
     if(!fs::is_directory(folder)) {
@@ -232,6 +251,7 @@ void runVNDTestsInFolder(string folder,Neigbourhood neighboorhoodMethod,SolverMe
                 PERTUBATION_VALUE_0,
                 true,
                 seed);
+            configuration.setTimeLimit(timeBudget,timeLimit);
             
             // solve instance with the given configuration
             solverResult result = solveSchedule(pfspInstance,configuration);
@@ -270,19 +290,10 @@ void runVNDTestsInFolder(string folder,Neigbourhood neighboorhoodMethod,SolverMe
 /**********************************************************************************/
 tuple<Configuration,solverResult> runOneThread(PfspInstance pfspInstance,Configuration sourceConfig,int seed){
 
-    // a separate config is build with the specfic seed and the general config parameters
+    // every thread gets its own copy of the general config with the specific seed
     // in order to be thread safe
-    Configuration config(
-            sourceConfig.getDatafile(),
-            sourceConfig.getInitSolution(),
-            sourceConfig.getNeighbourhood(),
-            sourceConfig.getPivotingRule(),
-            sourceConfig.getSolverMemory(),
-            sourceConfig.getannealingDecay(),
-            sourceConfig.getAnnealingLimit(),
-            sourceConfig.getPertubationValue(),
-            true,
-            seed);
+    Configuration config = sourceConfig;
+    config.setSeed(seed);
 
     // solve the instance based on the given configuration
     //inspired by : https://stackoverflow.com/questions/14718124/how-to-easily-make-stdcout-thread-safe
@@ -311,19 +322,28 @@ bool isReady(const std::future<tuple<Configuration,solverResult>> &f)
 /**
  * runs Simulate Annealing or ILS tests on multiple files using multiple threads
  * @param folder folder where the data files are stored
- * @param testType "ANNEAL" for simulated annealing or "PERTUB" for ILS
+ * @param testType "ANNEAL" for simulated annealing, "SA" for simulated annealing on
+ *                 single moves, "IG" for iterated greedy, "TS" for tabu search,
+ *                 "GA" for the memetic algorithm,
+ *                 "PERTUB" for ILS or "ISLANDS" for cooperative islands of IG and SA
  * @param solverMemory solver memory to use
+ * @param timeBudget the unit of the time limit
+ * @param timeLimit the time limit, 0 for the default limit of the instance
  * @param nbrOfIterations nbr of iterations and thus nb
  */
 /**********************************************************************************/
-void runAnnealPertubationTestsInFolder(string folder,string testType, SolverMemory solverMemory,int nbrOfIterations){
+void runAnnealPertubationTestsInFolder(string folder,string testType, SolverMemory solverMemory,TimeBudget timeBudget,float timeLimit,int nbrOfIterations){
     
     auto start = std::chrono::high_resolution_clock::now();
     FileHandler fileHandler;
     Pivotrules pivotRule; 
+    Neigbourhood neighbourhood = EXCHANGE;
     string file,errorString;
     float annealDecay;
     int annealLimit,pertubationValue,i;
+    Cooling cooling = FIXED;
+    int nbrOfIslands = 1;
+    int migrationInterval = 0;
     
     //check if directory is valid
     if(!fs::is_directory(folder)) {
@@ -355,6 +375,45 @@ void runAnnealPertubationTestsInFolder(string folder,string testType, SolverMemo
             pertubationValue = 0;
             pivotRule = ANNEAL;
         }
+        else if (testType.compare("SA") == 0){
+            annealDecay = ANNEAL_DECAY;
+            annealLimit = ANNEAL_RUN_LIMIT;
+            pertubationValue = 0;
+            pivotRule = SA;
+            cooling = TIMED;
+        }
+        else if (testType.compare("IG") == 0){
+            annealDecay = ANNEAL_DECAY;
+            annealLimit = ANNEAL_RUN_LIMIT;
+            pertubationValue = 0;
+            pivotRule = IG;
+            neighbourhood = TIE;
+        }
+        else if (testType.compare("TS") == 0){
+            annealDecay = ANNEAL_DECAY;
+            annealLimit = ANNEAL_RUN_LIMIT;
+            pertubationValue = 0;
+            pivotRule = TS;
+            neighbourhood = TIE;
+        }
+        else if (testType.compare("GA") == 0){
+            annealDecay = ANNEAL_DECAY;
+            annealLimit = ANNEAL_RUN_LIMIT;
+            pertubationValue = 0;
+            pivotRule = GA;
+            neighbourhood = TIE;
+        }
+        else if (testType.compare("ISLANDS") == 0){
+            annealDecay = ANNEAL_DECAY;
+            annealLimit = ANNEAL_RUN_LIMIT;
+            pertubationValue = 0;
+            pivotRule = IG;
+            neighbourhood = TIE;
+
+            // the runs share the cores, every run spreads its islands over its share
+            nbrOfIslands = std::max<int>(ISLAND_RUN_MIN_ISLANDS, std::thread::hardware_concurrency() / nbrOfIterations);
+            migrationInterval = ISLAND_RUN_MIGRATION_INTERVAL;
+        }
         else if (testType.compare("PERTUB") == 0){
             annealDecay = ANNEAL_DECAY;
             annealLimit = 0;
@@ -363,7 +422,7 @@ void runAnnealPertubationTestsInFolder(string folder,string testType, SolverMemo
                 case 5: pertubationValue = PERTUBATION_VALUE_5;break;
                 case 50: pertubationValue = PERTUBATION_VALUE_50;break;
                 case 100: pertubationValue = PERTUBATION_VALUE_100;break;
-                defaul: generateError("pertubation value for given number of jobs is not defined");
+                default: pertubationValue = std::max(PERTUBATION_VALUE_5, pfspInstance.getNbrOfJobs() / 10);
             }
         }
         else {
@@ -376,7 +435,7 @@ void runAnnealPertubationTestsInFolder(string folder,string testType, SolverMemo
         Configuration configuration(
             file,
             SRZH,
-            EXCHANGE,
+            neighbourhood,
             pivotRule,
             solverMemory,
             annealDecay,
@@ -384,6 +443,11 @@ void runAnnealPertubationTestsInFolder(string folder,string testType, SolverMemo
             pertubationValue,
             true,
             0);
+        configuration.setCooling(cooling);
+        configuration.setTimeLimit(timeBudget,timeLimit);
+        configuration.setNbrOfChains(nbrOfIslands);
+        configuration.setMigrationInterval(migrationInterval);
+        if(nbrOfIslands > 1) configuration.setIslandMix(MIXED);
         
         // Generate a vector of custom seeds (one for each thread)
         // inspired by https://stackoverflow.com/questions/50798713/c-generating-random-vector
@@ -409,6 +473,9 @@ void runAnnealPertubationTestsInFolder(string folder,string testType, SolverMemo
 
         int numFinishedTasks = 0;
 
+        // the results of the runs, by iteration
+        vector<solverResult> results(nbrOfIterations);
+
         // loop that keeps iterating while not all threads are finished
         // during each iteration all non resolved futures are checked in order to establish
         // if they have been resolved or not, if so, the results returnd by the future
@@ -423,10 +490,28 @@ void runAnnealPertubationTestsInFolder(string folder,string testType, SolverMemo
                     numFinishedTasks++;
                     auto [threadConfig,result] = futures[i].get();
                     fileHandler.save_result_to_file(result,threadConfig);
+                    results[i] = result;
                 }
             }
         }
         while(numFinishedTasks < nbrOfIterations);
+
+        // the best distinct schedules of the runs are collected in an elite pool, in the
+        // order of the iterations so that the pool does not depend on which run finished first
+        ElitePool elitePool(ELITE_POOL_SIZE, std::max(ELITE_MIN_DISTANCE, pfspInstance.getNbrOfJobs() / ELITE_DISTANCE_DIVISOR),
+                            pfspInstance.getNbrOfJobs());
+        for(const solverResult & result : results) elitePool.offer(result.objectiveScore, result.sequence);
+
+        // path relinking between the elite schedules, on all cores now the runs are done,
+        // is saved as one more result of the file
+        const int nbrOfEliteSchedules = elitePool.getSize();
+        if(nbrOfEliteSchedules > 1){
+            solverResult relinked = relinkElitePool(elitePool, pfspInstance, configuration, 
+                                                    std::max<int>(1, std::thread::hardware_concurrency()));
+            std::cout << "path relinking of " << nbrOfEliteSchedules << " elite schedules: " << relinked.relinkingStatistics 
+                      << ", best after relinking " << relinked.objectiveScore << endl;
+            fileHandler.save_result_to_file(relinked, configuration);
+        }
     }
     
     auto stop = std::chrono::high_resolution_clock::now();
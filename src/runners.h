@@ -9,8 +9,8 @@
     #include "configuration.h"
 
     void runOneTest(Configuration configuration);
-    void runAllTestsInFolder(std::string folder,SolverMemory solverMemory,int nbrOfIterations);
-    void runVNDTestsInFolder(string folder,Neigbourhood neighboorhoodMethod,SolverMemory solverMemory,int nbrOfIterations);
-    void runAnnealPertubationTestsInFolder(string folder,string testType, SolverMemory solverMemory,int nbrOfIterations);
+    void runAllTestsInFolder(std::string folder,SolverMemory solverMemory,TimeBudget timeBudget,float timeLimit,int nbrOfIterations);
+    void runVNDTestsInFolder(string folder,Neigbourhood neighboorhoodMethod,SolverMemory solverMemory,TimeBudget timeBudget,float timeLimit,int nbrOfIterations);
+    void runAnnealPertubationTestsInFolder(string folder,string testType, SolverMemory solverMemory,TimeBudget timeBudget,float timeLimit,int nbrOfIterations);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,100 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* file contains the best solution shared by searches that run in parallel. Every
+/* search publishes the solutions that improve on its own best solution, the shared
+/* solution is only replaced by a better one or, at an equal score, by the one of
+/* the search with the lowest index, so that the shared solution at the end does not 
+/* depend on the order in which the searches publish. Its score can be read without
+/* a lock, so that a search can cheaply compare with it.
+/********************************************************************************/
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <limits>
+
+#include "sharedincumbent.h"
+
+
+/**********************************************************************************/
+/**
+ * constructor, the shared incumbent starts without a solution
+ */
+/**********************************************************************************/
+SharedIncumbent::SharedIncumbent(): objectiveScore(std::numeric_limits<long int>::max()){
+    this->owner = -1;
+    this->nbrOfUpdates = 0;
+}
+
+
+/**********************************************************************************/
+/**
+ * destructor
+ */
+/**********************************************************************************/
+SharedIncumbent::~SharedIncumbent(){
+}
+
+
+/**********************************************************************************/
+/**
+ * offers a solution to replace the shared solution, can be called from any thread
+ * @param objectiveScore the score of the solution
+ * @param solution the solution
+ * @param owner the index of the search that found the solution
+ * @return true if the solution replaced the shared solution
+ */
+/**********************************************************************************/
+bool SharedIncumbent::publish(long int objectiveScore, const vector<int> & solution, int owner){
+    if(objectiveScore > this->objectiveScore.load(std::memory_order_relaxed)) return false;
+    std::lock_guard<std::mutex> lock(mutex);
+    const long int sharedScore = this->objectiveScore.load(std::memory_order_relaxed);
+    if(objectiveScore > sharedScore || (objectiveScore == sharedScore && owner >= this->owner)) return false;
+    this->solution = solution;
+    this->owner = owner;
+    this->objectiveScore.store(objectiveScore, std::memory_order_relaxed);
+    ++nbrOfUpdates;
+    return true;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the score of the shared solution, the maximal long int without a solution
+ */
+/**********************************************************************************/
+long int SharedIncumbent::getObjectiveScore(){
+    return objectiveScore.load(std::memory_order_relaxed);
+}
+
+
+/**********************************************************************************/
+/**
+ * @return a copy of the shared solution
+ */
+/**********************************************************************************/
+vector<int> SharedIncumbent::getSolution(){
+    std::lock_guard<std::mutex> lock(mutex);
+    return solution;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the index of the search that found the shared solution, -1 without one
+ */
+/**********************************************************************************/
+int SharedIncumbent::getOwner(){
+    std::lock_guard<std::mutex> lock(mutex);
+    return owner;
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the number of times the shared solution was replaced
+ */
+/**********************************************************************************/
+long int SharedIncumbent::getNbrOfUpdates(){
+    std::lock_guard<std::mutex> lock(mutex);
+    return nbrOfUpdates;
+}
@@ -0,0 +1,37 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* headerfile for sharedincumbent.cpp
+/********************************************************************************/
+#ifndef _SHAREDINCUMBENT_H_
+#define _SHAREDINCUMBENT_H_
+
+#include <vector>
+#include <mutex>
+#include <atomic>
+
+using std::vector;
+
+
+// class definition
+class SharedIncumbent{
+    private:
+        std::mutex mutex;
+
+        // the score can be read without the lock, the solution and its owner only under it
+        std::atomic<long int> objectiveScore;
+        vector<int> solution;
+        int owner;
+        long int nbrOfUpdates;
+
+    public:
+        SharedIncumbent();
+        ~SharedIncumbent();
+
+        bool publish(long int objectiveScore, const vector<int> & solution, int owner);
+        long int getObjectiveScore();
+        vector<int> getSolution();
+        int getOwner();
+        long int getNbrOfUpdates();
+};
+
+#endif
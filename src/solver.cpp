@@ -5,11 +5,15 @@
 #include <iostream>
 #include <limits>
 #include <chrono>
-#include <map>
-#include <unordered_map>
 #include <random>
 #include <algorithm>
+#include <numeric>
 #include <thread>
+#include <memory>
+#include <cmath>
+#include <future>
+#include <functional>
+#include <atomic>
 
 #include "solver.h"
 
@@ -19,26 +23,34 @@
 #include "initsolution.h"
 #include "neighbourhood.h"
 #include "pfspinstance.h"
+#include "evaluator.h"
+#include "batchevaluator.h"
+#include "solverpolicies.h"
+#include "coolingschedule.h"
+#include "deadline.h"
+#include "sharedincumbent.h"
+#include "mailbox.h"
+#include "threadpool.h"
+#include "population.h"
+#include "descent.h"
+#include "branchandbound.h"
 
 using std::endl;
 using std::vector;
 
+// number of moves a speculative part of the first improvement scan is scored in at
+// once, before it checks whether a part before it already found an improvement
+const int SPECULATION_BLOCK = 64;
 
-/**********************************************************************************/
-/**
- * helper hashfunction to hash a vector
- * inspired by https://stackoverflow.com/questions/29855908/c-unordered-set-of-vectors
- */
-/**********************************************************************************/
-struct VectorHash {
-    size_t operator()(const std::vector<int>& v) const {
-        std::hash<int> hasher;
-        size_t seed = 0;
-        for (int i : v) {
-            seed ^= hasher(i) + 0x9e3779b9 + (seed<<6) + (seed>>2);
-        }
-        return seed;
-    }
+
+// the connections of a solver that runs as one island of several: the best solution
+// shared by all islands, the mailbox in which it receives migrants from the previous
+// island of the ring and the mailbox of the next island it sends migrants to
+struct Island{
+    int index;
+    SharedIncumbent * sharedIncumbent;
+    Mailbox * inbox;
+    Mailbox * outbox;
 };
 
 
@@ -52,12 +64,28 @@ struct VectorHash {
  * @return the Metropolis Probability for the given solution
  */
 /**********************************************************************************/
-float computeMetropolisProbability(int result, int bestResult,float temperature){
+float computeMetropolisProbability(long int result, long int bestResult,float temperature){
     if (result<bestResult) return 1;
     else return std::exp((bestResult-result)/temperature);
 }
 
 
+/**********************************************************************************/
+/**
+ * calculates the constant temperature at which the IG pivoting rule accepts worse
+ * solutions, following the temperature of Ruiz and Stuetzle
+ * @param pfspInstance the instance to solve
+ * @return IG_TEMPERATURE_FACTOR times the average processing time of an operation
+ *         divided by 10
+ */
+/**********************************************************************************/
+float computeIteratedGreedyTemperature(PfspInstance & pfspInstance){
+    double sumOfProcessTimes = 0;
+    for(int job = 1; job <= pfspInstance.getNbrOfJobs(); ++job) sumOfProcessTimes += pfspInstance.getSumOfProcessTimes(job);
+    return IG_TEMPERATURE_FACTOR * sumOfProcessTimes / (10.0 * pfspInstance.getNbrOfJobs() * pfspInstance.getNbrOfMachines());
+}
+
+
 /**********************************************************************************/
 /**
  * pertubate a given random number of jobs by moving them 
@@ -100,58 +128,1021 @@ vector<int> pertubateSolution(int nbrOfMoves, vector<int> solution,std::mt19937
 
 /**********************************************************************************/
 /**
- *  solve one schedule 
- * @param pfspInstance the instance to use in the test
- * @param configuration the configuration object to use
- * @return a solverResult object containing the results
+ * local search solver for one schedule, compiled for one combination of a pivoting
+ * rule, a memory backend and an acceptance criterion (see solverpolicies.h)
  */
 /**********************************************************************************/
-solverResult solveSchedule(PfspInstance pfspInstance,Configuration config){
+template<class Pivot, class Memory, class Acceptance>
+class ScheduleSolver{
+    private:
+        PfspInstance & pfspInstance;
+        Configuration & config;
+        std::mt19937 generator;
 
-    //timing inspired by: https://www.geeksforgeeks.org/measure-execution-time-function-cpp/
-    auto start = std::chrono::high_resolution_clock::now();
-    auto stop = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(stop - start);
-    
-    // select the max duration the solver can run based on the number of jobs in the instance
-    long int maxDuration; 
-    switch(pfspInstance.getNbrOfJobs()){
-        case 5: maxDuration = MAX_DURATION_5;break;
-        case 50: maxDuration = MAX_DURATION_50;break;
-        case 100: maxDuration = MAX_DURATION_100;break;
-        default: generateError("ERROR. file:solver.cpp, method:solveSchedule. NbrOfJobs must be 50 or 100");
+        // settings of the configuration, resolved once
+        vector<MoveGenerator> neighbourhoodSequence;
+        Deadline deadline;
+        CoolingSchedule coolingSchedule;
+        const int annealingLimit;
+        const int pertubationValue;
+        const int destructionSize;
+        const IlsAcceptance ilsAcceptance;
+
+        // the local optima are escaped by perturbation when the pertubation value is
+        // above 2, only for the pivoting rules that do not accept worse neighbours
+        const bool iterateLocalSearch;
+
+        // tabu search: the iteration until which a job may not return to a position it
+        // left, at index job times the size of the solution plus position
+        const int tabuTenure;
+        vector<long int> tabuUntil;
+
+        // connections with the islands that run in parallel, if any
+        Island * island;
+        const int migrationInterval;
+        const MigrantAdoption migrantAdoption;
+        vector<int> migrant;
+        int migrantsReceived = 0;
+        int migrantsAdopted = 0;
+
+        // memetic algorithm: the offspring of a generation are created and improved by
+        // the workers of the pool (or one worker without pool), every offspring counts
+        // its own evaluations
+        const int populationSize;
+        const Crossover crossoverType;
+        vector<DescentWorker> offspringWorkers;
+        vector<long int> offspringEvaluations;
+        vector<long int> offspringPruned;
+
+        Memory memory;
+
+        // cache with the completion times of the solution the neighbourhood is built from
+        CompletionTimesCache solutionCache;
+
+        // cache with the completion times of that solution without the job that gets
+        // reinserted by the INSERT neighbours, shared by all neighbours that remove
+        // the same job
+        CompletionTimesCache partialCache;
+        vector<int> partialSolution;
+        int removedPosition = 0;
+
+        // when the complete neighbourhood gets evaluated anyway, the neighbours are scored
+        // up front in blocks that run in parallel vector lanes
+        BatchEvaluator batchEvaluator;
+        bool useBatchEvaluation;
+        vector<long int> batchObjectiveScores;
+        std::unique_ptr<bool[]> batchPruned;
+
+        // with more than one thread, the batch is divided in parts of DEADLINE_CHECK_INTERVAL
+        // neighbours that are scored by the workers of the pool, every worker with its
+        // own batch evaluator (worker 0 uses batchEvaluator)
+        std::unique_ptr<ThreadPool> threadPool;
+        vector<BatchEvaluator> workerEvaluators;
+
+        // first improvement in parallel: the parts are scored speculatively, one round
+        // of parts ahead of the neighbours that are selected in order, and the parts 
+        // after the lowest improving neighbour of a round are cancelled
+        bool useSpeculativeEvaluation;
+        std::atomic<int> lowestImprovement;
+
+        vector<long int> neighbourObjectiveScores;
+        vector<int> neighbourSelectionOrder;
+
+        vector<int> neighbour;
+        vector<int> bestSolution;
+        vector<int> initSolution;
+        long int bestObjectiveScore;
+
+        long int neighboursCount = 0;
+        long int neighbourhoodscount = 0;
+        long int neighboursPrunedCount = 0;
+        float initAnnealingTemp;
+        int annealcounter = 0;
+        int totalAnnealcounter = 0;
+
+        // objective score of initSolution when single moves are annealed, the solution
+        // the next destruction or perturbation starts from with its score when iterating
+        long int currentObjectiveScore;
+        vector<int> currentSolution;
+        vector<int> removedJobs;
+
+        template<Neigbourhood TYPE>
+        long int computeNeighbourTardiness(const Move & move, long int cutoff, bool & pruned);
+
+        int scoreRound(const Move* moves, int nbrOfMoves, int first, long int cutoff, bool speculative);
+
+        template<Neigbourhood TYPE>
+        bool scanNeighbourhood(MoveGenerator & moves);
+
+        template<Neigbourhood TYPE>
+        bool isTabu(const Move & move, const vector<int> & sequence);
+        template<Neigbourhood TYPE>
+        int scanTabuNeighbourhood(MoveGenerator & moves, long int & bestMoveObjectiveScore);
+        template<Neigbourhood TYPE>
+        void applyTabuMove(const Move & move);
+        void searchTabu();
+
+        void evolve();
+
+        template<Neigbourhood TYPE>
+        void annealMove(const Move & move);
+        void annealSingleMoves();
+
+        void publish(long int objectiveScore, const vector<int> & solution);
+        bool isMigrationDue(long int counter);
+        bool migrate(long int & objectiveScore, vector<int> & solution, long int emigrantObjectiveScore, const vector<int> & emigrant);
+
+        void descend();
+        bool destructAndConstruct();
+        bool scoreInitSolution();
+        void acceptLocalOptimum();
+        void iterate();
+
+    public:
+        ScheduleSolver(PfspInstance & pfspInstance, Configuration & config, Island * island = nullptr);
+        solverResult solve();
+};
+
+
+/**********************************************************************************/
+/**
+ * constructor, resolves the settings of the configuration that are not turned into
+ * policy types
+ * @param pfspInstance the instance to solve
+ * @param config the configuration object to use
+ * @param island the connections with the other islands, nullptr when the solver 
+ *               runs alone
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+ScheduleSolver<Pivot, Memory, Acceptance>::ScheduleSolver(PfspInstance & pfspInstance, Configuration & config, Island * island):
+    pfspInstance(pfspInstance),
+    config(config),
+    generator(config.getSeed()),
+    deadline(config.getTimeBudget(), getBudget(config, pfspInstance.getNbrOfJobs(), pfspInstance.getNbrOfMachines())),
+    coolingSchedule(config.getCooling(), config.getannealingDecay()),
+    annealingLimit(config.getAnnealingLimit()),
+    pertubationValue(config.getPertubationValue()),
+    destructionSize(std::min(config.getDestructionSize(), pfspInstance.getNbrOfJobs() - 1)),
+    ilsAcceptance(config.getIlsAcceptance()),
+    iterateLocalSearch(config.getPertubationValue() > 2 && !Pivot::acceptWorseNeighbours && !Pivot::iterateGreedy && !Pivot::useTabuList && 
+                       !Pivot::evolvePopulation),
+    tabuTenure(config.getTabuTenure() > 0 ? config.getTabuTenure() : std::max(TABU_MIN_TENURE, pfspInstance.getNbrOfJobs() / 10)),
+    island(island),
+    migrationInterval(config.getMigrationInterval()),
+    migrantAdoption(config.getMigrantAdoption()),
+    populationSize(config.getPopulationSize()),
+    crossoverType(config.getCrossover()),
+    memory(pfspInstance.getNbrOfJobs(), config),
+    solutionCache(pfspInstance),
+    partialCache(pfspInstance),
+    batchEvaluator(pfspInstance)
+{
+    // one generator per neighbourhood of the sequence, the neighbours themselves are
+    // never materialised
+    for(Neigbourhood type : config.getNeighbourhoodVector()){
+        if(type != TRANSPOSE && type != EXCHANGE && type != INSERT)
+            generateError("ERROR. file:solver.cpp, method:solveSchedule. chosen neighbourhood is not implemented");
+        neighbourhoodSequence.push_back(MoveGenerator(type, pfspInstance.getNbrOfJobs()));
+    }
+
+    // only used for the scans without memory, in parallel also without vector lanes
+    const int nbrOfThreads = config.getNbrOfThreads();
+    useBatchEvaluation = Pivot::scoreNeighbourhoodUpFront && (batchEvaluator.getInstructionSet() != SCALAR_LANES || nbrOfThreads > 1);
+    useSpeculativeEvaluation = Pivot::stopAtFirstImprovement && !Pivot::shuffleNeighbours && !Pivot::evolvePopulation && nbrOfThreads > 1;
+    if((useBatchEvaluation || useSpeculativeEvaluation) && nbrOfThreads > 1){
+        threadPool.reset(new ThreadPool(nbrOfThreads));
+        workerEvaluators.assign(nbrOfThreads - 1, batchEvaluator);
     }
 
-    // set random generator
-    std::mt19937 generator(config.getSeed()); 
-    std::uniform_real_distribution<> getRandomFloat(0, 1);
+    // the memetic algorithm divides the offspring of a generation over the pool
+    if(Pivot::evolvePopulation){
+        if(nbrOfThreads > 1) threadPool.reset(new ThreadPool(nbrOfThreads));
+        offspringWorkers.reserve(nbrOfThreads);
+        for(int worker = 0; worker < nbrOfThreads; ++worker) offspringWorkers.emplace_back(pfspInstance);
+    }
+}
 
 
-    // define variables
-    int i,j;
-    bool goToNextNeighbourhood = true;
-    bool continueToNextNeighbour = true;
+/**********************************************************************************/
+/**
+ * computes the weighted tardiness of the neighbour obtained by a move. The
+ * evaluation stops as soon as it can not beat the cutoff, the returned score is 
+ * then a lower bound and the pruned flag is set. 
+ * The move must be applied on neighbour, except for the insert moves that are
+ * evaluated on the partial cache.
+ * @param move the move to evaluate
+ * @param cutoff objective above which the exact score is not needed
+ * @param pruned set when the evaluation was stopped early
+ * @return the (bounded) weighted tardiness of the neighbour
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+template<Neigbourhood TYPE>
+inline long int ScheduleSolver<Pivot, Memory, Acceptance>::computeNeighbourTardiness(const Move & move, long int cutoff, bool & pruned){
+
+    // when the neighbourhood is scanned in order, the insert neighbours removing the
+    // same job follow each other and only the reinserted part needs to be computed
+    if(TYPE == INSERT && !Pivot::shuffleNeighbours){
+        const vector<int> & base = solutionCache.getSequence();
+        if(move.first != removedPosition){
+            partialSolution = base;
+            partialSolution.erase(partialSolution.begin() + move.first);
+            partialCache.setSequence(partialSolution);
+            removedPosition = move.first;
+        }
+        return partialCache.evaluateInsertion(base[move.first], move.second, cutoff, &pruned);
+    }
+    return solutionCache.evaluate(neighbour, move.first, cutoff, &pruned);
+}
+
+
+/**********************************************************************************/
+/**
+ * scores one round of parts of DEADLINE_CHECK_INTERVAL moves into the batch scores,
+ * one part per thread of the pool (or one part without pool). A speculative round
+ * scores a part in blocks of SPECULATION_BLOCK moves and stops at a neighbour that 
+ * beats the cutoff, or as soon as a part before it found such a neighbour: the scan
+ * of the first improvement stops at that neighbour at the latest, so the scores
+ * after it are never read. The scores that are read do not depend on the threads.
+ * @param moves the moves of the neighbourhood
+ * @param nbrOfMoves the number of moves of the neighbourhood
+ * @param first the first move of the round
+ * @param cutoff objective above which the exact score is not needed
+ * @param speculative true to stop at the first neighbour that beats the cutoff
+ * @return the move after the last move of the round
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+int ScheduleSolver<Pivot, Memory, Acceptance>::scoreRound(const Move* moves, int nbrOfMoves, int first, long int cutoff, bool speculative){
+    const int nbrOfParts = threadPool ? threadPool->getNbrOfThreads() : 1;
+    const int last = std::min(nbrOfMoves, first + nbrOfParts * DEADLINE_CHECK_INTERVAL);
+    const int blockSize = speculative ? SPECULATION_BLOCK : DEADLINE_CHECK_INTERVAL;
+    lowestImprovement.store(last, std::memory_order_relaxed);
+
+    const std::function<void(int, int)> scorePart = [&](int part, int worker){
+        BatchEvaluator & evaluator = (worker == 0) ? batchEvaluator : workerEvaluators[worker - 1];
+        const int partEnd = std::min(last, first + (part + 1) * DEADLINE_CHECK_INTERVAL);
+        for(int block = first + part * DEADLINE_CHECK_INTERVAL; block < partEnd; block += blockSize){
+            if(speculative && block > lowestImprovement.load(std::memory_order_relaxed)) return;
+            const int count = std::min(blockSize, partEnd - block);
+            evaluator.evaluate(solutionCache, moves + block, count, batchObjectiveScores.data() + block, cutoff, batchPruned.get() + block);
+            if(!speculative) continue;
+
+            // publish the improving neighbour when it is the lowest one so far
+            for(int index = block; index < block + count; ++index){
+                if(batchPruned[index] || batchObjectiveScores[index] >= cutoff) continue;
+                int lowest = lowestImprovement.load(std::memory_order_relaxed);
+                while(index < lowest && !lowestImprovement.compare_exchange_weak(lowest, index, std::memory_order_relaxed));
+                return;
+            }
+        }
+    };
+    if(threadPool) threadPool->run(nbrOfParts, scorePart);
+    else scorePart(0, 0);
+    return last;
+}
+
+
+/**********************************************************************************/
+/**
+ * evaluates the neighbours of initSolution obtained by the given moves and keeps
+ * the accepted ones as best solution
+ * @param moves the moves of the neighbourhood, of neighbourhood type TYPE
+ * @return true if a neighbour was accepted
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+template<Neigbourhood TYPE>
+bool ScheduleSolver<Pivot, Memory, Acceptance>::scanNeighbourhood(MoveGenerator & moves){
+    const int nbrOfMoves = moves.size();
     bool betterNeighbourFound = false;
-    long int neighboursCount = 0;
-    long int neighbourhoodscount = 0;
-    float annealingDecay = config.getannealingDecay();
-    float initAnnealingTemp, annealingTemp;
 
-    std::map<vector<int>, long int> memoryMap;
-    std::unordered_map<vector<int>, long int,VectorHash> memoryHash;
-    long int memoryUsedCount = 0;
+    // the partial insert evaluation does not need the neighbour itself
+    const bool applyOnNeighbour = TYPE != INSERT || Pivot::shuffleNeighbours;
+
+    // only the positions that changed since the previous neighbourhood get recomputed
+    solutionCache.setSequence(initSolution);
+    removedPosition = 0;
+    neighbour = initSolution;
+
+    // the memory decides per scan whether it is used for the neighbourhood type
+    const bool useMemory = Memory::enabled && memory.startScan(TYPE);
+    if(useMemory) memory.setSequence(initSolution);
+    const bool useBatch = useBatchEvaluation && !useMemory;
+
+    // the batch is evaluated in rounds, so that the deadline is checked in between
+    const long int cutoff = Pivot::pruneAgainstBest ? bestObjectiveScore : NO_CUTOFF;
+    const bool useSpeculation = useSpeculativeEvaluation && !useMemory;
+    if(useBatch || useSpeculation){
+        batchObjectiveScores.resize(nbrOfMoves);
+        batchPruned.reset(new bool[nbrOfMoves]);
+    }
+    int scoredMoves = 0;
+    while(useBatch && scoredMoves < nbrOfMoves && !deadline.checkNow())
+        scoredMoves = scoreRound(moves.data(), nbrOfMoves, scoredMoves, cutoff, false);
+
+    // if annealing is used, randomize the order in which neighbours get selected
+    if(Pivot::shuffleNeighbours){
+        neighbourSelectionOrder.resize(nbrOfMoves);
+        std::iota(neighbourSelectionOrder.begin(), neighbourSelectionOrder.end(), 0);
+        std::shuffle(neighbourSelectionOrder.begin(), neighbourSelectionOrder.end(), generator);
+    }
+    if(Pivot::acceptWorseNeighbours) neighbourObjectiveScores.resize(nbrOfMoves);
+
+    //-------------------------------------------------------------------------------------
+    // iterate over neighbours in neighbourhood until the deadline expires
+    //-------------------------------------------------------------------------------------
+    for(int i = 0; i < nbrOfMoves && !deadline.check(); ++i){
+        ++neighboursCount;
+        const int index = Pivot::shuffleNeighbours ? neighbourSelectionOrder[i] : i;
+        const Move & move = moves[index];
+        if(useSpeculation && i == scoredMoves) scoredMoves = scoreRound(moves.data(), nbrOfMoves, i, cutoff, true);
+
+        //-------------------------------------------------------------------------------------
+        // get neighbour score    
+        // FIRST and BEST only need the exact score of neighbours that can match the best
+        // score, the evaluation of all other neighbours is stopped early
+        //-------------------------------------------------------------------------------------
+        bool pruned = false;
+        long int neighbourObjectiveScore;
+
+        if(useBatch || useSpeculation){
+            neighbourObjectiveScore = batchObjectiveScores[index];
+            pruned = batchPruned[index];
+        }
+        else{
+            if(applyOnNeighbour) applyMove<TYPE>(neighbour, move);
+            if(useMemory) 
+                neighbourObjectiveScore = memory.retrieve(move, cutoff, pruned, 
+                    [&](long int cutoff, bool & pruned){ return computeNeighbourTardiness<TYPE>(move, cutoff, pruned); });
+            else neighbourObjectiveScore = computeNeighbourTardiness<TYPE>(move, cutoff, pruned);
+            if(applyOnNeighbour) undoMove<TYPE>(neighbour, move);
+        }
+        if(pruned) ++neighboursPrunedCount;
+        if(Pivot::acceptWorseNeighbours) neighbourObjectiveScores[i] = neighbourObjectiveScore;
+
+        //-------------------------------------------------------------------------------------
+        // evaluate neighbour score    
+        // test whether new score is better than previous, the neighbour is only copied
+        // when it gets accepted
+        //-------------------------------------------------------------------------------------
+        if(Acceptance::accept(neighbourObjectiveScore, bestObjectiveScore, generator)){
+            bestObjectiveScore = neighbourObjectiveScore;
+            bestSolution = solutionCache.getSequence();
+            applyMove<TYPE>(bestSolution, move);
+            initSolution = bestSolution;
+            betterNeighbourFound = true;
+            annealcounter = 0;
+            if(Pivot::acceptWorseNeighbours) coolingSchedule.registerImprovement();
+            if(Pivot::stopAtFirstImprovement) break;
+        }
+    }
+    return betterNeighbourFound;
+}
+
+
+/**********************************************************************************/
+/**
+ * one step of simulated annealing on single moves: the neighbour obtained by the 
+ * move replaces initSolution following the Metropolis rule. The rule accepts
+ * a score below the current score minus the temperature times the logarithm of a 
+ * uniform random number, so the evaluation stops as soon as it exceeds that score.
+ * @param move the move to evaluate, of neighbourhood type TYPE
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+template<Neigbourhood TYPE>
+inline void ScheduleSolver<Pivot, Memory, Acceptance>::annealMove(const Move & move){
+    ++neighboursCount;
+    ++totalAnnealcounter;
+    const double threshold = currentObjectiveScore - coolingSchedule.getTemperature() * std::log(1.0 - std::generate_canonical<double, 32>(generator));
+    const long int cutoff = (threshold >= NO_CUTOFF) ? NO_CUTOFF : static_cast<long int>(threshold);
+
+    bool pruned = false;
+    applyMove<TYPE>(neighbour, move);
+    const long int neighbourObjectiveScore = computeNeighbourTardiness<TYPE>(move, cutoff, pruned);
+    if(pruned || neighbourObjectiveScore > cutoff){
+        ++neighboursPrunedCount;
+        undoMove<TYPE>(neighbour, move);
+        return;
+    }
+
+    // the neighbour is accepted and becomes the solution the next moves apply to
+    applyMove<TYPE>(initSolution, move);
+    solutionCache.setSequence(initSolution);
+    currentObjectiveScore = neighbourObjectiveScore;
+    if(currentObjectiveScore < bestObjectiveScore){
+        bestObjectiveScore = currentObjectiveScore;
+        bestSolution = initSolution;
+        annealcounter = 0;
+        coolingSchedule.registerImprovement();
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * simulated annealing on single moves drawn uniformly from all neighbourhoods of the
+ * sequence. The temperature is cooled once per temperature level, a level counts as
+ * many steps as there are moves, so that it corresponds to one step of ANNEAL. 
+ * Annealing stops when the deadline expires or when the annealing limit (if not 0)
+ * of levels without a new best solution is reached. After every level the best
+ * solution is shared with the other islands, every migrationInterval levels the
+ * island migrates.
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+void ScheduleSolver<Pivot, Memory, Acceptance>::annealSingleMoves(){
+    long int nbrOfMoves = 0;
+    for(MoveGenerator & moves : neighbourhoodSequence) nbrOfMoves += moves.size();
+    std::uniform_int_distribution<long int> moveDistribution(0, nbrOfMoves - 1);
+
+    currentObjectiveScore = bestObjectiveScore;
+    solutionCache.setSequence(initSolution);
+    neighbour = initSolution;
+
+    while(!deadline.checkNow() && (annealcounter < annealingLimit || annealingLimit == 0)){
+        ++neighbourhoodscount;
+        ++annealcounter;
+        for(long int step = 0; step < nbrOfMoves && !deadline.check(); ++step){
+            long int index = moveDistribution(generator);
+            int j = 0;
+            while(index >= neighbourhoodSequence[j].size()) index -= neighbourhoodSequence[j++].size();
+            MoveGenerator & moves = neighbourhoodSequence[j];
+            switch (moves.getType()){
+                case TRANSPOSE: annealMove<TRANSPOSE>(moves[index]); break;
+                case EXCHANGE:  annealMove<EXCHANGE>(moves[index]); break;
+                default:        annealMove<INSERT>(moves[index]); break;
+            }
+        }
+        coolingSchedule.cool();
+        publish(bestObjectiveScore, bestSolution);
+
+        // an adopted migrant becomes the solution the next moves apply to
+        if(isMigrationDue(neighbourhoodscount) && migrate(currentObjectiveScore, initSolution, bestObjectiveScore, bestSolution)){
+            solutionCache.setSequence(initSolution);
+            neighbour = initSolution;
+            if(currentObjectiveScore < bestObjectiveScore){
+                bestObjectiveScore = currentObjectiveScore;
+                bestSolution = initSolution;
+                annealcounter = 0;
+                coolingSchedule.registerImprovement();
+            }
+        }
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * shares a new best solution with the other islands, if any
+ * @param objectiveScore the score of the solution
+ * @param solution the solution
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+void ScheduleSolver<Pivot, Memory, Acceptance>::publish(long int objectiveScore, const vector<int> & solution){
+    if(island) island->sharedIncumbent->publish(objectiveScore, solution, island->index);
+}
+
+
+/**********************************************************************************/
+/**
+ * @param counter the number of iterations (ILS, IG, TS), generations (GA) or temperature
+ *                levels (SA) so far
+ * @return true if the island migrates after this iteration or temperature level
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+bool ScheduleSolver<Pivot, Memory, Acceptance>::isMigrationDue(long int counter){
+    return island && migrationInterval > 0 && counter % migrationInterval == 0;
+}
+
+
+/**********************************************************************************/
+/**
+ * sends the best solution of the island to the next island and adopts the migrant
+ * of the previous island, if one arrived since the last migration, following the
+ * adoption policy: IMPROVING adopts a migrant that is better than the current 
+ * solution, ALWAYS adopts every migrant. Neither side waits for the other.
+ * @param objectiveScore the score of the current solution, replaced on adoption
+ * @param solution the current solution, replaced on adoption
+ * @param emigrantObjectiveScore the score of the best solution of the island
+ * @param emigrant the best solution of the island
+ * @return true if the migrant was adopted
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+bool ScheduleSolver<Pivot, Memory, Acceptance>::migrate(long int & objectiveScore, vector<int> & solution, 
+                                                        long int emigrantObjectiveScore, const vector<int> & emigrant){
+    island->outbox->send(emigrantObjectiveScore, emigrant);
+    long int migrantObjectiveScore;
+    if(!island->inbox->receive(migrantObjectiveScore, migrant)) return false;
+    ++migrantsReceived;
+    if(migrantAdoption == IMPROVING && migrantObjectiveScore >= objectiveScore) return false;
+    ++migrantsAdopted;
+    solution = migrant;
+    objectiveScore = migrantObjectiveScore;
+    return true;
+}
+
+
+/**********************************************************************************/
+/**
+ * a move is tabu when it puts a job back on a position it left less than tabuTenure
+ * iterations ago, which is one lookup per moved job
+ * @param move the move, of neighbourhood type TYPE
+ * @param sequence the solution the move applies to
+ * @return true if the move is tabu in the current iteration
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+template<Neigbourhood TYPE>
+inline bool ScheduleSolver<Pivot, Memory, Acceptance>::isTabu(const Move & move, const vector<int> & sequence){
+    const long int size = sequence.size();
+    if(tabuUntil[sequence[move.first] * size + move.second] > totalAnnealcounter) return true;
+    return TYPE != INSERT && tabuUntil[sequence[move.second] * size + move.first] > totalAnnealcounter;
+}
+
+
+/**********************************************************************************/
+/**
+ * evaluates the neighbours of the solution in the solution cache obtained by the
+ * given moves and keeps the best admissible one: a neighbour that is not tabu, or a
+ * tabu neighbour that beats the best solution. Only a neighbour that beats the best
+ * admissible neighbour so far needs an exact score.
+ * @param moves the moves of the neighbourhood, of neighbourhood type TYPE
+ * @param bestMoveObjectiveScore the score of the best admissible neighbour so far,
+ *                               lowered when this neighbourhood has a better one
+ * @return the index of the best admissible move when it beats the best admissible
+ *         neighbour so far, -1 otherwise
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+template<Neigbourhood TYPE>
+int ScheduleSolver<Pivot, Memory, Acceptance>::scanTabuNeighbourhood(MoveGenerator & moves, long int & bestMoveObjectiveScore){
+    const int nbrOfMoves = moves.size();
+    const vector<int> & sequence = solutionCache.getSequence();
+    int bestIndex = -1;
+    for(int i = 0; i < nbrOfMoves && !deadline.check(); ++i){
+        ++neighboursCount;
+        const Move & move = moves[i];
+        const bool tabu = isTabu<TYPE>(move, sequence);
+        const long int cutoff = tabu ? std::min(bestMoveObjectiveScore, bestObjectiveScore - 1) : bestMoveObjectiveScore;
+
+        bool pruned = false;
+        if(TYPE != INSERT) applyMove<TYPE>(neighbour, move);
+        const long int neighbourObjectiveScore = computeNeighbourTardiness<TYPE>(move, cutoff, pruned);
+        if(TYPE != INSERT) undoMove<TYPE>(neighbour, move);
+        if(pruned){
+            ++neighboursPrunedCount;
+            continue;
+        }
+        if(neighbourObjectiveScore < bestMoveObjectiveScore && (!tabu || neighbourObjectiveScore < bestObjectiveScore)){
+            bestMoveObjectiveScore = neighbourObjectiveScore;
+            bestIndex = i;
+        }
+    }
+    return bestIndex;
+}
+
+
+/**********************************************************************************/
+/**
+ * applies a move on initSolution and makes it tabu for the moved jobs to return to
+ * the positions they leave
+ * @param move the move, of neighbourhood type TYPE
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+template<Neigbourhood TYPE>
+void ScheduleSolver<Pivot, Memory, Acceptance>::applyTabuMove(const Move & move){
+    const long int size = initSolution.size();
+    tabuUntil[initSolution[move.first] * size + move.first] = totalAnnealcounter + tabuTenure;
+    if(TYPE != INSERT) tabuUntil[initSolution[move.second] * size + move.second] = totalAnnealcounter + tabuTenure;
+    applyMove<TYPE>(initSolution, move);
+}
+
+
+/**********************************************************************************/
+/**
+ * tabu search: every iteration scans all neighbourhoods of the sequence from the 
+ * current solution in initSolution and moves to the best admissible neighbour, also
+ * when it is worse. The neighbours are evaluated incrementally on the solution 
+ * cache and the insert neighbours on the partial cache. The search stops when the
+ * deadline expires or when the annealing limit (if not 0) of iterations without a
+ * new best solution is reached. The best solution is shared with the other islands
+ * on every improvement, every migrationInterval iterations the island migrates.
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+void ScheduleSolver<Pivot, Memory, Acceptance>::searchTabu(){
+    tabuUntil.assign(initSolution.size() * initSolution.size(), 0);
+    currentObjectiveScore = bestObjectiveScore;
+    publish(bestObjectiveScore, bestSolution);
+
+    while(!deadline.checkNow() && (annealcounter < annealingLimit || annealingLimit == 0)){
+        ++totalAnnealcounter;
+        ++annealcounter;
+        ++neighbourhoodscount;
+        solutionCache.setSequence(initSolution);
+        removedPosition = 0;
+        neighbour = initSolution;
+
+        long int bestMoveObjectiveScore = NO_CUTOFF;
+        int bestNeighbourhood = -1;
+        int bestMove = -1;
+        for(int j = 0; j < neighbourhoodSequence.size() && !deadline.hasExpired(); ++j){
+            MoveGenerator & moves = neighbourhoodSequence[j];
+            int index;
+            switch (moves.getType()){
+                case TRANSPOSE: index = scanTabuNeighbourhood<TRANSPOSE>(moves, bestMoveObjectiveScore); break;
+                case EXCHANGE:  index = scanTabuNeighbourhood<EXCHANGE>(moves, bestMoveObjectiveScore); break;
+                default:        index = scanTabuNeighbourhood<INSERT>(moves, bestMoveObjectiveScore); break;
+            }
+            if(index < 0) continue;
+            bestNeighbourhood = j;
+            bestMove = index;
+        }
+
+        // when every neighbour is tabu, the next iteration has fewer tabu moves
+        if(bestNeighbourhood >= 0){
+            MoveGenerator & moves = neighbourhoodSequence[bestNeighbourhood];
+            switch (moves.getType()){
+                case TRANSPOSE: applyTabuMove<TRANSPOSE>(moves[bestMove]); break;
+                case EXCHANGE:  applyTabuMove<EXCHANGE>(moves[bestMove]); break;
+                default:        applyTabuMove<INSERT>(moves[bestMove]); break;
+            }
+            currentObjectiveScore = bestMoveObjectiveScore;
+        }
+
+        // an adopted migrant becomes the current solution
+        if(isMigrationDue(totalAnnealcounter)) migrate(currentObjectiveScore, initSolution, bestObjectiveScore, bestSolution);
+        if(currentObjectiveScore < bestObjectiveScore){
+            bestObjectiveScore = currentObjectiveScore;
+            bestSolution = initSolution;
+            annealcounter = 0;
+            publish(bestObjectiveScore, bestSolution);
+        }
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * memetic algorithm: a population of populationSize solutions (initSolution and 
+ * random solutions) creates every generation as many offspring. The parents of an
+ * offspring are chosen by binary tournaments, the offspring is their crossover, 
+ * shifted by one job with GA_MUTATION_PROBABILITY, and improved by a first 
+ * improvement descent of at most GA_LOCAL_SEARCH_EVALUATIONS times the squared 
+ * number of jobs evaluations. The best distinct solutions of the population and the
+ * offspring form the next generation.
+ * The offspring are created by the workers of the pool. Their parents and seeds are
+ * drawn before, so that a generation does not depend on the number of threads. The 
+ * evaluations of a generation are counted by the deadline afterwards, with a budget
+ * of evaluations the offspring share what is left of it so that it is never 
+ * exceeded. The search stops when the deadline expires or when the annealing limit
+ * (if not 0) of generations without a new best solution is reached. The best 
+ * solution is shared with the other islands on every improvement, every 
+ * migrationInterval generations the island migrates and an adopted migrant replaces
+ * the worst member.
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+void ScheduleSolver<Pivot, Memory, Acceptance>::evolve(){
+    const int nbrOfJobs = pfspInstance.getNbrOfJobs();
+    Population population(populationSize, nbrOfJobs);
+    Population offspring(populationSize, nbrOfJobs);
+    Population nextPopulation(populationSize, nbrOfJobs);
+
+    // the best member so far is published also when the deadline cuts the population short
+    population.setMember(0, initSolution.data(), bestObjectiveScore);
+    for(int member = 1; member < populationSize; ++member){
+        if(deadline.check()) break;
+        ++neighboursCount;
+        std::shuffle(initSolution.begin() + 1, initSolution.end(), generator);
+        solutionCache.setSequence(initSolution);
+        population.setMember(member, initSolution.data(), solutionCache.getObjective());
+        if(population.getObjectiveScore(member) >= bestObjectiveScore) continue;
+        bestObjectiveScore = population.getObjectiveScore(member);
+        bestSolution = initSolution;
+    }
+    publish(bestObjectiveScore, bestSolution);
+    if(deadline.hasExpired()) return;
+
+    const long int localSearchLimit = static_cast<long int>(GA_LOCAL_SEARCH_EVALUATIONS) * nbrOfJobs * nbrOfJobs;
+    vector<int> firstParents(populationSize);
+    vector<int> secondParents(populationSize);
+    vector<unsigned int> offspringSeeds(populationSize);
+    vector<int> candidates(2 * populationSize);
+    offspringEvaluations.assign(populationSize, 0);
+    offspringPruned.assign(populationSize, 0);
+
+    std::uniform_int_distribution<int> memberDistribution(0, populationSize - 1);
+    const auto tournament = [&](){
+        const int first = memberDistribution(generator);
+        const int second = memberDistribution(generator);
+        return population.getObjectiveScore(second) < population.getObjectiveScore(first) ? second : first;
+    };
+    const auto candidateScore = [&](int candidate){
+        return candidate < populationSize ? population.getObjectiveScore(candidate) 
+                                          : offspring.getObjectiveScore(candidate - populationSize);
+    };
+    const auto candidateSolution = [&](int candidate){
+        return candidate < populationSize ? population.getSolution(candidate) 
+                                          : offspring.getSolution(candidate - populationSize);
+    };
+
+    while(!deadline.checkNow() && (annealcounter < annealingLimit || annealingLimit == 0)){
+
+        // with a budget of evaluations, the offspring share what is left of it
+        long int limit = localSearchLimit;
+        if(deadline.isEvaluationBudget()){
+            const long int left = std::lround(deadline.getBudget() - deadline.getElapsed());
+            if(left < populationSize) break;
+            limit = std::min(limit, left / populationSize);
+        }
+        ++totalAnnealcounter;
+        ++annealcounter;
+        ++neighbourhoodscount;
+
+        for(int k = 0; k < populationSize; ++k){
+            firstParents[k] = tournament();
+            secondParents[k] = tournament();
+            offspringSeeds[k] = generator();
+        }
+
+        const std::function<void(int, int)> createOffspring = [&](int k, int worker){
+            DescentWorker & state = offspringWorkers[worker];
+            std::mt19937 offspringGenerator(offspringSeeds[k]);
+            state.solution.resize(nbrOfJobs + 1);
+            crossover(crossoverType, population.getSolution(firstParents[k]), population.getSolution(secondParents[k]), 
+                      state.solution.data(), nbrOfJobs, offspringGenerator, state.scratch);
+            if(std::generate_canonical<double, 32>(offspringGenerator) < GA_MUTATION_PROBABILITY)
+                shiftMutation(state.solution.data(), nbrOfJobs, offspringGenerator);
+
+            // the crossover itself counts as one evaluation
+            offspringEvaluations[k] = 1;
+            offspringPruned[k] = 0;
+            state.cache.setSequence(state.solution);
+            const long int objectiveScore = descendWithFirstImprovement(state, neighbourhoodSequence, state.cache.getObjective(), limit, 
+                                                                        &deadline, offspringEvaluations[k], offspringPruned[k]);
+            offspring.setMember(k, state.solution.data(), objectiveScore);
+        };
+        if(threadPool) threadPool->run(populationSize, createOffspring);
+        else for(int k = 0; k < populationSize; ++k) createOffspring(k, 0);
+
+        long int evaluations = 0;
+        for(int k = 0; k < populationSize; ++k){
+            evaluations += offspringEvaluations[k];
+            neighboursPrunedCount += offspringPruned[k];
+        }
+        neighboursCount += evaluations;
+        deadline.checkEvaluations(evaluations);
+
+        // the best distinct solutions survive, the population before the offspring at
+        // equal scores, duplicates only when there are not enough distinct solutions
+        std::iota(candidates.begin(), candidates.end(), 0);
+        std::stable_sort(candidates.begin(), candidates.end(), [&](int first, int second){
+            return candidateScore(first) < candidateScore(second);
+        });
+        int survivors = 0;
+        for(int & candidate : candidates){
+            if(survivors == populationSize) break;
+            bool duplicate = false;
+            for(int member = 0; member < survivors && !duplicate; ++member)
+                duplicate = nextPopulation.getObjectiveScore(member) == candidateScore(candidate) && 
+                            nextPopulation.isEqual(member, candidateSolution(candidate));
+            if(duplicate) continue;
+            nextPopulation.setMember(survivors++, candidateSolution(candidate), candidateScore(candidate));
+            candidate = -1;
+        }
+        for(int candidate : candidates){
+            if(survivors == populationSize) break;
+            if(candidate >= 0) nextPopulation.setMember(survivors++, candidateSolution(candidate), candidateScore(candidate));
+        }
+        population.swap(nextPopulation);
+
+        if(population.getObjectiveScore(0) < bestObjectiveScore){
+            bestObjectiveScore = population.getObjectiveScore(0);
+            bestSolution.assign(population.getSolution(0), population.getSolution(0) + nbrOfJobs + 1);
+            annealcounter = 0;
+            publish(bestObjectiveScore, bestSolution);
+        }
+
+        // an adopted migrant replaces the worst member, it is already shared
+        if(isMigrationDue(totalAnnealcounter)){
+            const int worst = populationSize - 1;
+            currentSolution.assign(population.getSolution(worst), population.getSolution(worst) + nbrOfJobs + 1);
+            currentObjectiveScore = population.getObjectiveScore(worst);
+            if(migrate(currentObjectiveScore, currentSolution, bestObjectiveScore, bestSolution)){
+                population.setMember(worst, currentSolution.data(), currentObjectiveScore);
+                if(currentObjectiveScore < bestObjectiveScore){
+                    bestObjectiveScore = currentObjectiveScore;
+                    bestSolution = currentSolution;
+                    annealcounter = 0;
+                }
+            }
+        }
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * descends from initSolution to a local optimum of the neighbourhood sequence, the
+ * local optimum is kept as best solution
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+void ScheduleSolver<Pivot, Memory, Acceptance>::descend(){
+    bool improved = true;
+    while(improved && !deadline.checkNow()){
+        improved = false;
+        ++neighbourhoodscount;
+        for(int j = 0; j < neighbourhoodSequence.size() && !improved && !deadline.hasExpired(); ++j){
+            MoveGenerator & moves = neighbourhoodSequence[j];
+            switch (moves.getType()){
+                case TRANSPOSE: improved = scanNeighbourhood<TRANSPOSE>(moves); break;
+                case EXCHANGE:  improved = scanNeighbourhood<EXCHANGE>(moves); break;
+                default:        improved = scanNeighbourhood<INSERT>(moves); break;
+            }
+        }
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * removes destructionSize random jobs from initSolution and reinserts them one by
+ * one at the position where the partial solution gets the lowest score. All 
+ * positions of a job are evaluated on the cache of the partial solution without it,
+ * and every position counts as an evaluated neighbour.
+ * @return false if the deadline expired before initSolution was reconstructed,
+ *         otherwise initSolution is the reconstructed solution and 
+ *         bestObjectiveScore its score
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+bool ScheduleSolver<Pivot, Memory, Acceptance>::destructAndConstruct(){
+    removedJobs.clear();
+    for(int k = 0; k < destructionSize; ++k){
+        std::uniform_int_distribution<int> positionDistribution(1, initSolution.size() - 1);
+        const int position = positionDistribution(generator);
+        removedJobs.push_back(initSolution[position]);
+        initSolution.erase(initSolution.begin() + position);
+    }
+
+    for(int job : removedJobs){
+        partialCache.setSequence(initSolution);
+        long int bestInsertionScore = NO_CUTOFF;
+        int bestPosition = 1;
+        for(int position = 1; position <= initSolution.size(); ++position){
+            if(deadline.check()) return false;
+            ++neighboursCount;
+
+            // only a position that beats the best position so far needs an exact score
+            bool pruned = false;
+            const long int insertionScore = partialCache.evaluateInsertion(job, position, bestInsertionScore, &pruned);
+            if(pruned) ++neighboursPrunedCount;
+            else if(insertionScore < bestInsertionScore){
+                bestInsertionScore = insertionScore;
+                bestPosition = position;
+            }
+        }
+        initSolution.insert(initSolution.begin() + bestPosition, job);
+        bestObjectiveScore = bestInsertionScore;
+    }
+    return true;
+}
+
+
+/**********************************************************************************/
+/**
+ * scores initSolution after a perturbation or a restart on the solution cache, 
+ * which only recomputes the positions after the first change, as one evaluation
+ * @return false if the deadline expired, otherwise bestObjectiveScore is the score
+ *         of initSolution
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+bool ScheduleSolver<Pivot, Memory, Acceptance>::scoreInitSolution(){
+    if(deadline.check()) return false;
+    ++neighboursCount;
+    solutionCache.setSequence(initSolution);
+    bestObjectiveScore = solutionCache.getObjective();
+    return true;
+}
+
+
+/**********************************************************************************/
+/**
+ * decides whether the local optimum in bestSolution replaces the current solution.
+ * Iterated greedy follows the Metropolis rule at a constant temperature, the 
+ * iterated local search follows its acceptance criterion: BETTER and RESTART
+ * accept a better local optimum, WALK accepts every local optimum.
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+void ScheduleSolver<Pivot, Memory, Acceptance>::acceptLocalOptimum(){
+    bool accept;
+    if(Pivot::iterateGreedy)
+        accept = bestObjectiveScore <= currentObjectiveScore || std::generate_canonical<double, 32>(generator) < 
+                 computeMetropolisProbability(bestObjectiveScore, currentObjectiveScore, coolingSchedule.getTemperature());
+    else accept = ilsAcceptance == WALK || bestObjectiveScore < currentObjectiveScore;
+    if(!accept) return;
+    currentSolution = bestSolution;
+    currentObjectiveScore = bestObjectiveScore;
+}
+
+
+/**********************************************************************************/
+/**
+ * iterated greedy or iterated local search: the current solution is destructed and
+ * reconstructed or perturbed, the local search descends from the result and the 
+ * local optimum replaces the current solution following the acceptance criterion.
+ * With the RESTART criterion, the current solution is replaced by a random solution
+ * every ILS_RESTART_ITERATIONS iterations without a new best solution. During the
+ * local search bestSolution holds the local optimum, the best solution of all 
+ * iterations is restored at the end and shared with the other islands on every
+ * improvement. Every migrationInterval iterations the island migrates.
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+void ScheduleSolver<Pivot, Memory, Acceptance>::iterate(){
+    descend();
+    vector<int> incumbentSolution = bestSolution;
+    long int incumbentObjectiveScore = bestObjectiveScore;
+    currentSolution = bestSolution;
+    currentObjectiveScore = bestObjectiveScore;
+    publish(incumbentObjectiveScore, incumbentSolution);
+
+    while(!deadline.checkNow() && (annealcounter < annealingLimit || annealingLimit == 0)){
+        ++totalAnnealcounter;
+        ++annealcounter;
+        
+        // restart from a random solution when the best solution stagnates
+        const bool restart = !Pivot::iterateGreedy && ilsAcceptance == RESTART && annealcounter % ILS_RESTART_ITERATIONS == 0;
+        if(Pivot::iterateGreedy){
+            initSolution = currentSolution;
+            if(!destructAndConstruct()) break;
+        }
+        else{
+            initSolution = restart ? currentSolution : pertubateSolution(pertubationValue, currentSolution, generator);
+            if(restart) std::shuffle(initSolution.begin() + 1, initSolution.end(), generator);
+            if(!scoreInitSolution()) break;
+        }
+        bestSolution = initSolution;
+        descend();
+
+        if(restart){
+            currentSolution = bestSolution;
+            currentObjectiveScore = bestObjectiveScore;
+        }
+        else acceptLocalOptimum();
+
+        if(bestObjectiveScore < incumbentObjectiveScore){
+            incumbentSolution = bestSolution;
+            incumbentObjectiveScore = bestObjectiveScore;
+            annealcounter = 0;
+            publish(incumbentObjectiveScore, incumbentSolution);
+        }
+
+        // an adopted migrant becomes the current solution, it is already shared
+        if(isMigrationDue(totalAnnealcounter) && migrate(currentObjectiveScore, currentSolution, incumbentObjectiveScore, incumbentSolution) &&
+           currentObjectiveScore < incumbentObjectiveScore){
+            incumbentSolution = currentSolution;
+            incumbentObjectiveScore = currentObjectiveScore;
+            annealcounter = 0;
+        }
+    }
+    bestSolution = incumbentSolution;
+    bestObjectiveScore = incumbentObjectiveScore;
+}
+
 
-    Neigbourhood neighbourhoodMethod;
-    vector<vector<int>> neighbourhood;
-    vector<int> neighbour;
-    vector<int> bestSolution;
-    vector<int> initSolution;
-    long int bestObjectiveScore;
-    long int neighbourObjectiveScore;
-    int annealcounter = 0;
-    int totalAnnealcounter = 0;
+/**********************************************************************************/
+/**
+ * solves the schedule
+ * @return a solverResult object containing the results
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory, class Acceptance>
+solverResult ScheduleSolver<Pivot, Memory, Acceptance>::solve(){
 
+    //timing inspired by: https://www.geeksforgeeks.org/measure-execution-time-function-cpp/
+    auto start = std::chrono::high_resolution_clock::now();
+    auto stop = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(stop - start);
+    
+    // the max duration follows from the time limit of the configuration or, by default,
+    // from the size of the instance, a budget of evaluations has no max duration
+    deadline.start();
+    const long int maxDuration = deadline.isEvaluationBudget() ? 0 : std::lround(deadline.getBudget());
 
+    bool goToNextNeighbourhood = true;
+    int j;
 
     /**********************************************/
     // CREATE INITIAL SOLUTION
@@ -165,149 +1156,70 @@ solverResult solveSchedule(PfspInstance pfspInstance,Configuration config){
     else generateError("ERROR. file:solver.cpp, method:solveSchedule. chosen intitial solution is not implemented");
             
     bestObjectiveScore  = pfspInstance.computeSolutionTardiness(bestSolution);
-    annealingTemp = bestObjectiveScore * INIT_ANNEAL_TEMP_MULTIPLIER;
-;
-    initAnnealingTemp = annealingTemp;
+    initAnnealingTemp = Pivot::iterateGreedy ? computeIteratedGreedyTemperature(pfspInstance) 
+                                             : bestObjectiveScore * INIT_ANNEAL_TEMP_MULTIPLIER;
+    coolingSchedule.start(initAnnealingTemp, 
+                          Pivot::sampleSingleMoves ? MINIMAL_SINGLE_MOVE_ANNEAL_TEMP : MINIMAL_ANNEAL_TEMP,
+                          deadline);
     initSolution = bestSolution;
 
+    if(Pivot::sampleSingleMoves) annealSingleMoves();
+    if(Pivot::iterateGreedy || iterateLocalSearch) iterate();
+    if(Pivot::useTabuList) searchTabu();
+    if(Pivot::evolvePopulation) evolve();
+
     /**********************************************/
     // iterate over neighbourhoods as long as going to
-    // a next neighbourhood is allowed and the max
-    // duration is not exceeded
+    // a next neighbourhood is allowed and the
+    // deadline has not expired
     /**********************************************/
-    while(goToNextNeighbourhood && duration < std::chrono::milliseconds(maxDuration)){
-        stop = std::chrono::high_resolution_clock::now();
-        duration = std::chrono::duration_cast<std::chrono::milliseconds>(stop - start);
-
+    while(!Pivot::sampleSingleMoves && !Pivot::iterateGreedy && !iterateLocalSearch && !Pivot::useTabuList && 
+          !Pivot::evolvePopulation && goToNextNeighbourhood && !deadline.checkNow()){
         goToNextNeighbourhood = false;
-        continueToNextNeighbour = true;
         ++neighbourhoodscount;
 
-        // get vector containing the neighbourhood construction methods to use
-        // and iterate over them as long as no better solution is found
-        vector<Neigbourhood> neighbourhoodVector = config.getNeighbourhoodVector(); 
-        for(j=0;j < neighbourhoodVector.size() && !goToNextNeighbourhood;++j){
-            
-            // create neighbourhood from initSolution as provided from the previous iteration
-            neighbourhoodMethod = neighbourhoodVector[j];
-            switch (neighbourhoodMethod){
-                case TRANSPOSE: neighbourhood = neighbourhoodTranspose(initSolution); break;
-                case EXCHANGE:  neighbourhood = neighbourhoodExchange(initSolution); break;
-                case INSERT:    neighbourhood = neighbourhoodInsert(initSolution); break;
-                default: generateError("ERROR. file:solver.cpp, method:solveSchedule. chosen neighbourhood is not implemented");
+        // iterate over the neighbourhoods of the sequence as long as no better solution is found
+        for(j=0;j < neighbourhoodSequence.size() && !goToNextNeighbourhood;++j){
+            MoveGenerator & moves = neighbourhoodSequence[j];
+            switch (moves.getType()){
+                case TRANSPOSE: goToNextNeighbourhood = scanNeighbourhood<TRANSPOSE>(moves); break;
+                case EXCHANGE:  goToNextNeighbourhood = scanNeighbourhood<EXCHANGE>(moves); break;
+                default:        goToNextNeighbourhood = scanNeighbourhood<INSERT>(moves); break;
             }
 
-            vector<long int> neighbourObjectiveScores(neighbourhood.size());
-
-            // create neighbourhood index to decide the order in which neighbours get evaluated
-            // if annealing is used, randomize the order in which neighbours get selected
-            std::vector<int> neighbourSelectionOrder(neighbourhood.size());
-            std::iota(neighbourSelectionOrder.begin(), neighbourSelectionOrder.end(), 0);
-            if(config.getPivotingRule() == ANNEAL)
-                std::shuffle(neighbourSelectionOrder.begin(), neighbourSelectionOrder.end(), generator);
-
-        
-            //-------------------------------------------------------------------------------------
-            // iterate over neighbours in neighbourhood 
-            //-------------------------------------------------------------------------------------
-            // loop through all neighbours in neighbourhood as long as continueToNextNeighbour flag is high 
-            for( i = 0; (i < neighbourhood.size()) && continueToNextNeighbour; ++i){
-                ++neighboursCount;
-                neighbour = neighbourhood[neighbourSelectionOrder[i]];
-                
-                
-                //-------------------------------------------------------------------------------------
-                // get neighbour score    
-                //-------------------------------------------------------------------------------------
-                //using map memory to store and retrieve computed Tardiness 
-                if(config.getSolverMemory() == MAP){
-                    if (auto search = memoryMap.find(neighbour); search != memoryMap.end()){
-                            neighbourObjectiveScore = search->second;
-                            ++memoryUsedCount;
-                    }
-                    else{
-                        neighbourObjectiveScore = pfspInstance.computeSolutionTardiness(neighbour);
-                        memoryMap[neighbour] = neighbourObjectiveScore;
-                    }
-                }
-
-                //using unordered set with hash memory to store and retrieve computed Tardiness 
-                else if(config.getSolverMemory()==HASH){
-                    if (auto search = memoryHash.find(neighbour); search != memoryHash.end()){
-                            neighbourObjectiveScore = search->second;
-                            ++memoryUsedCount;
-                    }
-                    else{
-                        neighbourObjectiveScore = pfspInstance.computeSolutionTardiness(neighbour);
-                        memoryHash[neighbour] = neighbourObjectiveScore;
-                    }
-                }
-
-                // without memory
-                else if(config.getSolverMemory() == NONE){
-                    neighbourObjectiveScore = pfspInstance.computeSolutionTardiness(neighbour);
-                } 
-                
-                neighbourObjectiveScores[i] = neighbourObjectiveScore;
-
-                //-------------------------------------------------------------------------------------
-                // evaluate neighbour score    
-                // test whether new score is better than previous
-                // if ChooseRandomWhenEqual is selected a random choose will be made when objective scores are equal
-                //-------------------------------------------------------------------------------------
-                if((neighbourObjectiveScore < bestObjectiveScore) || 
-                    (config.getChooseRandomWhenEqual() && (neighbourObjectiveScore == bestObjectiveScore) && (generator() % 2) == 0))
-                {
-                    bestObjectiveScore = neighbourObjectiveScore;
-                    bestSolution = neighbour;
-                    initSolution = bestSolution;
-                    if(config.getPivotingRule() == FIRST) continueToNextNeighbour = false;
-                    goToNextNeighbourhood = true;
-                    annealcounter = 0;
-                }
-                
-
-                             
-            } // END OF FOR LOOP FOR SEARCHING BEST IN NEIGHBOURHOOD
+            // a scan that was cut off by the deadline ends the search
+            if(deadline.hasExpired()) break;
 
             // if simulated annealing is set, allow choosing a worse solution for the next neighbourhood if no better solution was found
-            if(config.getPivotingRule() == ANNEAL && 
+            if(Pivot::acceptWorseNeighbours && 
                 !goToNextNeighbourhood && 
-                (annealcounter < config.getAnnealingLimit() || config.getAnnealingLimit() == 0)){
+                (annealcounter < annealingLimit || annealingLimit == 0)){
                 
                 // calculate the Metropolis probabilities
+                const float annealingTemp = coolingSchedule.getTemperature();
                 std::vector<float> probabilities(neighbourObjectiveScores.size());
                 std::transform(
                     neighbourObjectiveScores.begin(),
                     neighbourObjectiveScores.end(),
                     probabilities.begin(),
-                    [bestObjectiveScore,annealingTemp](int x) { return computeMetropolisProbability(x,bestObjectiveScore,annealingTemp);}); 
+                    [this, annealingTemp](long int x) { return computeMetropolisProbability(x,bestObjectiveScore,annealingTemp);}); 
+
+                // when no neighbour has a probability left (all of them were visited before),
+                // a random neighbour is chosen
+                if(std::accumulate(probabilities.begin(), probabilities.end(), 0.0) == 0.0)
+                    std::fill(probabilities.begin(), probabilities.end(), 1.0);
                 std::discrete_distribution<> distribution(probabilities.begin(), probabilities.end());
                 
-                // choose a new initSolution based on the Metropolis probabilities
+                // choose a new initSolution based on the Metropolis probabilities, the scores
+                // are stored in the order in which the neighbours were evaluated
                 int chosenValue = distribution(generator);
-                initSolution = neighbourhood[chosenValue];
+                applyMove(initSolution, moves[neighbourSelectionOrder[chosenValue]]);
                 ++annealcounter;
                 ++totalAnnealcounter;
-                annealingTemp = annealingTemp * annealingDecay;
-                if(annealingTemp <= MINIMAL_ANNEAL_TEMP) annealingTemp = MINIMAL_ANNEAL_TEMP;
+                coolingSchedule.cool();
                 goToNextNeighbourhood = true;
 
             }
-            
-            // If ILS is selected, pertubate the best found solution so far and check if this pertubed solution
-            // results in a better objective score. If yes, use the pertubed solution as new best solution.
-            // if no, keep the original best solution.
-            if(config.getPertubationValue() > 2){
-                vector<int> pertubatedSolution = pertubateSolution(config.getPertubationValue(),bestSolution,generator);
-                long int pertubatedObjectiveScore = pfspInstance.computeSolutionTardiness(pertubatedSolution);
-                if (pertubatedObjectiveScore < bestObjectiveScore) {
-                    initSolution = pertubatedSolution;
-                    bestSolution = pertubatedSolution;
-                }
-                else initSolution = bestSolution;
-                goToNextNeighbourhood = true;
-            }      
         }
     } 
  
@@ -316,27 +1228,202 @@ solverResult solveSchedule(PfspInstance pfspInstance,Configuration config){
     //-------------------------------------------------------------------------------------
     stop = std::chrono::high_resolution_clock::now();
     duration = std::chrono::duration_cast<std::chrono::milliseconds>(stop - start);
-    
-
-    int memorySize;
-    if(config.getSolverMemory() == MAP) memorySize = memoryMap.size();
-    else if(config.getSolverMemory()==HASH) memorySize = memoryHash.size();
-    else memorySize = 0;
 
     solverResult result = {
         .sequence = bestSolution,
         .objectiveScore = bestObjectiveScore,
         .duration = duration.count(),
         .durationLimit = maxDuration,
+        .overshoot = static_cast<float>(deadline.getOvershoot()),
+        .evaluationsPerSecond = static_cast<float>(neighboursCount / std::chrono::duration<double>(stop - start).count()),
         .neighboursTested = neighboursCount,
         .neighbourhoodsTested = neighbourhoodscount,
+        .neighboursPruned = neighboursPrunedCount,
         .initAnnealingTemp = initAnnealingTemp,
-        .finalAnnealingTemp = annealingTemp,
+        .finalAnnealingTemp = coolingSchedule.getTemperature(),
         .annealingSteps = totalAnnealcounter,
-        .memorySize = memorySize,
-        .memoryRetrievals = memoryUsedCount
+        .annealingReheats = coolingSchedule.getNbrOfReheats(),
+        .memorySize = memory.size(),
+        .memoryRetrievals = memory.retrievals(),
+        .memoryMisses = memory.misses(),
+        .memoryEvictions = memory.evictions(),
+        .memoryBytes = memory.bytes(),
+        .memoryFalsePositiveRate = memory.falsePositiveRate(),
+        .memoryDecisions = memory.decisions(),
+        .migrantsReceived = migrantsReceived,
+        .migrantsAdopted = migrantsAdopted,
+        .islandStatistics = "",
+        .relinkingStatistics = "",
+        .lowerBound = 0
         };
     return result;
+}
+
 
+/**********************************************************************************/
+/**
+ * resolves the acceptance criterion of the configuration and solves the schedule
+ * @param pfspInstance the instance to use in the test
+ * @param config the configuration object to use
+ * @param island the connections with the other islands, or nullptr
+ * @return a solverResult object containing the results
+ */
+/**********************************************************************************/
+template<class Pivot, class Memory>
+solverResult solveScheduleWithMemory(PfspInstance & pfspInstance, Configuration & config, Island * island){
+    if(config.getChooseRandomWhenEqual())
+        return ScheduleSolver<Pivot, Memory, RandomTieAcceptance>(pfspInstance, config, island).solve();
+    return ScheduleSolver<Pivot, Memory, StrictAcceptance>(pfspInstance, config, island).solve();
 }
 
+
+/**********************************************************************************/
+/**
+ * resolves the memory backend of the configuration and solves the schedule
+ * @param pfspInstance the instance to use in the test
+ * @param config the configuration object to use
+ * @param island the connections with the other islands, or nullptr
+ * @return a solverResult object containing the results
+ */
+/**********************************************************************************/
+template<class Pivot>
+solverResult solveScheduleWithPivot(PfspInstance & pfspInstance, Configuration & config, Island * island){
+    switch(config.getSolverMemory()){
+        case NONE: return solveScheduleWithMemory<Pivot, NoMemory>(pfspInstance, config, island);
+        case HASH: return solveScheduleWithMemory<Pivot, HashMemory>(pfspInstance, config, island);
+        case MAP:  return solveScheduleWithMemory<Pivot, MapMemory>(pfspInstance, config, island);
+        case FLAT: return solveScheduleWithMemory<Pivot, FlatMemory>(pfspInstance, config, island);
+        case BLOOM: 
+            // skipping revisits is only right when the cutoff of the scans only goes down between perturbations
+            if(!Pivot::pruneAgainstBest) generateError("ERROR. file:solver.cpp, method:solveSchedule. the BLOOM memory can not be used with ANNEAL");
+            return solveScheduleWithMemory<Pivot, BloomMemory>(pfspInstance, config, island);
+        case ADAPTIVE: return solveScheduleWithMemory<Pivot, AdaptiveMemory>(pfspInstance, config, island);
+    }
+    generateError("ERROR. file:solver.cpp, method:solveSchedule. chosen solver memory is not implemented");
+    return {};
+}
+
+
+/**********************************************************************************/
+/**
+ * solves the schedule on one island. The configuration is resolved once to the 
+ * solver compiled for its pivoting rule, memory and acceptance criterion
+ * @param pfspInstance the instance to use in the test, every island needs its own
+ * @param config the configuration object to use
+ * @param island the connections with the other islands, or nullptr
+ * @return a solverResult object containing the results
+ */
+/**********************************************************************************/
+solverResult solveIsland(PfspInstance pfspInstance, Configuration config, Island * island){
+    switch(config.getPivotingRule()){
+        case FIRST:  return solveScheduleWithPivot<FirstImprovementPivot>(pfspInstance, config, island);
+        case BEST:   return solveScheduleWithPivot<BestImprovementPivot>(pfspInstance, config, island);
+        case ANNEAL: return solveScheduleWithPivot<AnnealingPivot>(pfspInstance, config, island);
+
+        // a single evaluation is cheaper than a lookup in a memory
+        case SA:     return solveScheduleWithMemory<SingleMoveAnnealingPivot, NoMemory>(pfspInstance, config, island);
+        case IG:     return solveScheduleWithPivot<IteratedGreedyPivot>(pfspInstance, config, island);
+
+        // the neighbourhood moves along with every iteration, so a memory hardly hits
+        case TS:     return solveScheduleWithMemory<TabuSearchPivot, NoMemory>(pfspInstance, config, island);
+
+        // the offspring are improved on the caches of the workers, without memory
+        case GA:     return solveScheduleWithMemory<MemeticPivot, NoMemory>(pfspInstance, config, island);
+
+        // an exact search of the partial sequences, it runs its own threads
+        case BB:     return BranchAndBound(pfspInstance, config).solve();
+    }
+    generateError("ERROR. file:solver.cpp, method:solveSchedule. chosen pivoting rule is not implemented");
+    return {};
+}
+
+
+/**********************************************************************************/
+/**
+ * the configuration of an island: its own seed (the seed of the configuration plus
+ * the index of the island) and, when the islands are MIXED, SA with TIMED cooling
+ * on every odd island (IG when the configuration is SA)
+ * @param config the configuration of the solve
+ * @param index the index of the island
+ * @return the configuration of the island
+ */
+/**********************************************************************************/
+Configuration getIslandConfiguration(Configuration config, int index){
+    Configuration islandConfig = config;
+    islandConfig.setSeed(config.getSeed() + index);
+    if(config.getIslandMix() == MIXED && index % 2 == 1){
+        if(config.getPivotingRule() == SA) islandConfig.setPivotingRule(IG);
+        else{
+            islandConfig.setPivotingRule(SA);
+            islandConfig.setCooling(TIMED);
+        }
+    }
+    return islandConfig;
+}
+
+
+/**********************************************************************************/
+/**
+ *  solve one schedule. Simulated annealing on single moves, the iterated greedy, the
+ *  iterated local search, tabu search and the memetic algorithm can run as several islands, every island on its own 
+ *  thread with its own seed and its own budget. The islands share their best 
+ *  solution and, every migrationInterval iterations or temperature levels, send 
+ *  their best solution to the next island of a ring through a mailbox and adopt the
+ *  migrant of the previous island. The result is the result of the island with the
+ *  best solution (the lowest index at equal scores) with the counters of all 
+ *  islands summed up and the statistics of every island.
+ * @param pfspInstance the instance to use in the test
+ * @param configuration the configuration object to use
+ * @return a solverResult object containing the results
+ */
+/**********************************************************************************/
+solverResult solveSchedule(PfspInstance pfspInstance,Configuration config){
+    const bool iterates = config.getPivotingRule() == IG || config.getPivotingRule() == SA || config.getPivotingRule() == TS ||
+                          config.getPivotingRule() == GA ||
+                          (config.getPertubationValue() > 2 && (config.getPivotingRule() == FIRST || config.getPivotingRule() == BEST));
+    const int nbrOfIslands = iterates ? config.getNbrOfChains() : 1;
+    if(nbrOfIslands == 1) return solveIsland(pfspInstance, config, nullptr);
+
+    SharedIncumbent sharedIncumbent;
+    vector<std::unique_ptr<Mailbox>> mailboxes;
+    for(int index = 0; index < nbrOfIslands; ++index) mailboxes.emplace_back(new Mailbox(pfspInstance.getNbrOfJobs() + 1));
+    vector<Island> islands(nbrOfIslands);
+    vector<Configuration> islandConfigs;
+    vector<std::future<solverResult>> futures(nbrOfIslands);
+    for(int index = 0; index < nbrOfIslands; ++index){
+        islands[index] = {index, &sharedIncumbent, mailboxes[index].get(), mailboxes[(index + 1) % nbrOfIslands].get()};
+        islandConfigs.push_back(getIslandConfiguration(config, index));
+        futures[index] = std::async(std::launch::async, solveIsland, pfspInstance, islandConfigs[index], &islands[index]);
+    }
+    vector<solverResult> results;
+    for(std::future<solverResult> & future : futures) results.push_back(future.get());
+
+    // an island that ran out of budget before it published leaves no owner, then the
+    // best result of the islands counts
+    int owner = sharedIncumbent.getOwner();
+    if(owner < 0){
+        owner = 0;
+        for(int index = 1; index < nbrOfIslands; ++index)
+            if(results[index].objectiveScore < results[owner].objectiveScore) owner = index;
+    }
+    solverResult result = results[owner];
+    for(int index = 0; index < nbrOfIslands; ++index){
+        if(!result.islandStatistics.empty()) result.islandStatistics += "; ";
+        result.islandStatistics += std::to_string(index) + " " + PIVOTING_RULE_STRINGS[islandConfigs[index].getPivotingRule()] +
+                                   " score " + std::to_string(results[index].objectiveScore) +
+                                   " evaluations " + std::to_string(results[index].neighboursTested) +
+                                   " adopted " + std::to_string(results[index].migrantsAdopted) +
+                                   " of " + std::to_string(results[index].migrantsReceived);
+        if(index == owner) continue;
+        result.duration = std::max(result.duration, results[index].duration);
+        result.overshoot = std::max(result.overshoot, results[index].overshoot);
+        result.evaluationsPerSecond += results[index].evaluationsPerSecond;
+        result.neighboursTested += results[index].neighboursTested;
+        result.neighbourhoodsTested += results[index].neighbourhoodsTested;
+        result.neighboursPruned += results[index].neighboursPruned;
+        result.annealingSteps += results[index].annealingSteps;
+        result.migrantsReceived += results[index].migrantsReceived;
+        result.migrantsAdopted += results[index].migrantsAdopted;
+    }
+    return result;
+}
@@ -16,13 +16,27 @@ struct solverResult{
         long int objectiveScore;
         long int duration;
         long int durationLimit;
+        float overshoot;
+        float evaluationsPerSecond;
         long int neighboursTested;
         long int neighbourhoodsTested;
+        long int neighboursPruned;
         float initAnnealingTemp;
         float finalAnnealingTemp;
         int annealingSteps;
+        int annealingReheats;
         long int memorySize;
         long int memoryRetrievals;
+        long int memoryMisses;
+        long int memoryEvictions;
+        long int memoryBytes;
+        float memoryFalsePositiveRate;
+        std::string memoryDecisions;
+        int migrantsReceived;
+        int migrantsAdopted;
+        std::string islandStatistics;
+        std::string relinkingStatistics;
+        long int lowerBound;
 };   
 
 solverResult solveSchedule(PfspInstance pfspInstance,Configuration configuration);
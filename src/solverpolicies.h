@@ -0,0 +1,492 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* policy types the solver is instantiated with. Every setting of the configuration
+/* that is consulted per neighbour is turned into a type, so that the solver is
+/* compiled once per combination and the unused branches disappear from the
+/* neighbour loop. A new strategy is added as a new policy type.
+/********************************************************************************/
+#ifndef _SOLVERPOLICIES_H_
+#define _SOLVERPOLICIES_H_
+
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <random>
+#include <cstdint>
+#include <chrono>
+#include <string>
+#include <algorithm>
+
+#include "configuration.h"
+#include "neighbourhood.h"
+#include "permutationhash.h"
+#include "flatmemory.h"
+#include "bloomfilter.h"
+#include "memoryadvisor.h"
+#include "evaluator.h"
+
+using std::vector;
+
+
+/**********************************************************************************/
+/**
+ * value stored in the solver memory, neighbours whose evaluation was stopped early
+ * against the incumbent are stored with a lower bound instead of their exact score
+ */
+/**********************************************************************************/
+struct memoryEntry{
+    long int objectiveScore;
+    bool isLowerBound;
+};
+
+
+/**********************************************************************************/
+/**
+ * PIVOTING RULES
+ * stopAtFirstImprovement: the scan of a neighbourhood ends at the first accepted neighbour
+ * shuffleNeighbours: the neighbours are evaluated in a random order
+ * pruneAgainstBest: only neighbours that can match the best score need an exact score
+ * acceptWorseNeighbours: a worse neighbour can be chosen when no improvement is found
+ * scoreNeighbourhoodUpFront: the complete neighbourhood is always evaluated, so that
+ *                            it can be scored up front by the batch evaluator
+ * sampleSingleMoves: instead of scanning neighbourhoods, one random move is evaluated
+ *                    and accepted following the Metropolis rule per step
+ * iterateGreedy: the local optima of the neighbourhoods are escaped by destructing and
+ *                greedily reconstructing part of the solution
+ * useTabuList: instead of descending, the search moves to the best neighbour that does
+ *              not put a job back on a position it recently left
+ * evolvePopulation: instead of following one solution, a population of solutions is
+ *                   recombined and every offspring is improved by a local search
+ */
+/**********************************************************************************/
+struct FirstImprovementPivot{
+    static const Pivotrules rule = FIRST;
+    static const bool stopAtFirstImprovement = true;
+    static const bool shuffleNeighbours = false;
+    static const bool pruneAgainstBest = true;
+    static const bool acceptWorseNeighbours = false;
+    static const bool scoreNeighbourhoodUpFront = false;
+    static const bool sampleSingleMoves = false;
+    static const bool iterateGreedy = false;
+    static const bool useTabuList = false;
+    static const bool evolvePopulation = false;
+};
+
+struct BestImprovementPivot{
+    static const Pivotrules rule = BEST;
+    static const bool stopAtFirstImprovement = false;
+    static const bool shuffleNeighbours = false;
+    static const bool pruneAgainstBest = true;
+    static const bool acceptWorseNeighbours = false;
+    static const bool scoreNeighbourhoodUpFront = true;
+    static const bool sampleSingleMoves = false;
+    static const bool iterateGreedy = false;
+    static const bool useTabuList = false;
+    static const bool evolvePopulation = false;
+};
+
+struct AnnealingPivot{
+    static const Pivotrules rule = ANNEAL;
+    static const bool stopAtFirstImprovement = false;
+    static const bool shuffleNeighbours = true;
+    static const bool pruneAgainstBest = false;
+    static const bool acceptWorseNeighbours = true;
+    static const bool scoreNeighbourhoodUpFront = true;
+    static const bool sampleSingleMoves = false;
+    static const bool iterateGreedy = false;
+    static const bool useTabuList = false;
+    static const bool evolvePopulation = false;
+};
+
+// the moves are drawn in a random order, so the INSERT moves are evaluated on the
+// complete neighbour
+struct SingleMoveAnnealingPivot{
+    static const Pivotrules rule = SA;
+    static const bool stopAtFirstImprovement = false;
+    static const bool shuffleNeighbours = true;
+    static const bool pruneAgainstBest = false;
+    static const bool acceptWorseNeighbours = true;
+    static const bool scoreNeighbourhoodUpFront = false;
+    static const bool sampleSingleMoves = true;
+    static const bool iterateGreedy = false;
+    static const bool useTabuList = false;
+    static const bool evolvePopulation = false;
+};
+
+// the local search between two reconstructions descends with first improvement
+struct IteratedGreedyPivot{
+    static const Pivotrules rule = IG;
+    static const bool stopAtFirstImprovement = true;
+    static const bool shuffleNeighbours = false;
+    static const bool pruneAgainstBest = true;
+    static const bool acceptWorseNeighbours = false;
+    static const bool scoreNeighbourhoodUpFront = false;
+    static const bool sampleSingleMoves = false;
+    static const bool iterateGreedy = true;
+    static const bool useTabuList = false;
+    static const bool evolvePopulation = false;
+};
+
+// every iteration moves to the best neighbour of all neighbourhoods that is not tabu
+// or beats the best solution, a worse neighbour included
+struct TabuSearchPivot{
+    static const Pivotrules rule = TS;
+    static const bool stopAtFirstImprovement = false;
+    static const bool shuffleNeighbours = false;
+    static const bool pruneAgainstBest = true;
+    static const bool acceptWorseNeighbours = false;
+    static const bool scoreNeighbourhoodUpFront = false;
+    static const bool sampleSingleMoves = false;
+    static const bool iterateGreedy = false;
+    static const bool useTabuList = true;
+    static const bool evolvePopulation = false;
+};
+
+// every generation recombines members of a population into offspring that are
+// improved by a short first improvement descent before they compete for a place
+struct MemeticPivot{
+    static const Pivotrules rule = GA;
+    static const bool stopAtFirstImprovement = true;
+    static const bool shuffleNeighbours = false;
+    static const bool pruneAgainstBest = true;
+    static const bool acceptWorseNeighbours = false;
+    static const bool scoreNeighbourhoodUpFront = false;
+    static const bool sampleSingleMoves = false;
+    static const bool iterateGreedy = false;
+    static const bool useTabuList = false;
+    static const bool evolvePopulation = true;
+};
+
+
+/**********************************************************************************/
+/**
+ * MEMORY BACKENDS
+ * startScan is called at the start of every neighbourhood scan and returns whether
+ * the memory is used during the scan, setSequence is then called with the solution
+ * the neighbourhood is built from.
+ * retrieve returns the score of the neighbour obtained by applying a move to that
+ * solution, computed by the given evaluate function 
+ * (long int evaluate(long int cutoff, bool & pruned)) when it is not remembered.
+ * A stored lower bound can only be used when it still exceeds the cutoff, 
+ * otherwise the neighbour is evaluated and its (exact or bounded) score is stored.
+ * bytes returns the (for the node based containers estimated) heap size.
+ * decisions returns the log of an adaptive memory.
+ * Memories are constructed with the number of jobs and the configuration.
+ */
+/**********************************************************************************/
+class NoMemory{
+    public:
+        static const bool enabled = false;
+
+        NoMemory(int nbrOfJobs, Configuration & config){}
+        bool startScan(Neigbourhood type){ return false; }
+        void setSequence(const vector<int> & solution){}
+
+        template<class Evaluate>
+        inline long int retrieve(const Move & move, long int cutoff, bool & pruned, Evaluate evaluate){
+            return evaluate(cutoff, pruned);
+        }
+        long int size(){ return 0; }
+        long int retrievals(){ return 0; }
+        long int misses(){ return 0; }
+        long int evictions(){ return 0; }
+        long int bytes(){ return 0; }
+        float falsePositiveRate(){ return 0; }
+        std::string decisions(){ return ""; }
+};
+
+
+// red-black tree keyed on the neighbour itself
+class MapMemory{
+    private:
+        std::map<vector<int>, memoryEntry> memory;
+        vector<int> sequence;
+        vector<int> neighbour;
+        long int retrievalCount = 0;
+        long int missCount = 0;
+
+    public:
+        static const bool enabled = true;
+
+        MapMemory(int nbrOfJobs, Configuration & config){}
+        bool startScan(Neigbourhood type){ return true; }
+        void setSequence(const vector<int> & solution){ sequence = solution; }
+
+        template<class Evaluate>
+        inline long int retrieve(const Move & move, long int cutoff, bool & pruned, Evaluate evaluate){
+            neighbour = sequence;
+            applyMove(neighbour, move);
+            auto search = memory.find(neighbour);
+            if(search != memory.end() && (!search->second.isLowerBound || search->second.objectiveScore > cutoff)){
+                ++retrievalCount;
+                pruned = search->second.isLowerBound;
+                return search->second.objectiveScore;
+            }
+            ++missCount;
+            long int objectiveScore = evaluate(cutoff, pruned);
+            memory[neighbour] = {objectiveScore, pruned};
+            return objectiveScore;
+        }
+        long int size(){ return memory.size(); }
+        long int retrievals(){ return retrievalCount; }
+        long int misses(){ return missCount; }
+        long int evictions(){ return 0; }
+        float falsePositiveRate(){ return 0; }
+        std::string decisions(){ return ""; }
+        long int bytes(){
+            // tree node with three pointers and a colour, the key and the value
+            return memory.size() * (4 * sizeof(void*) + sizeof(vector<int>) + sizeof(memoryEntry) + sequence.size() * sizeof(int));
+        }
+};
+
+
+// hash table keyed on the permutation hash of the neighbour, which follows in 
+// constant time from the move. The neighbour itself is stored to verify a match,
+// on a collision the entry is replaced.
+class HashMemory{
+    private:
+        struct hashedMemoryEntry{
+            vector<int> solution;
+            long int objectiveScore;
+            bool isLowerBound;
+        };
+        PermutationHash hasher;
+        std::unordered_map<std::uint64_t, hashedMemoryEntry> memory;
+        long int retrievalCount = 0;
+        long int missCount = 0;
+
+        // compares a stored solution with the neighbour without constructing the neighbour
+        inline bool isNeighbour(const vector<int> & solution, const Move & move){
+            const vector<int> & sequence = hasher.getSequence();
+            for(int p = move.first; p <= move.second; ++p)
+                if(solution[p] != getJobAfterMove(sequence, move, p)) return false;
+            for(int p = 1; p < move.first; ++p)
+                if(solution[p] != sequence[p]) return false;
+            for(int p = move.second + 1; p < sequence.size(); ++p)
+                if(solution[p] != sequence[p]) return false;
+            return true;
+        }
+
+    public:
+        static const bool enabled = true;
+
+        HashMemory(int nbrOfJobs, Configuration & config): hasher(nbrOfJobs){}
+        bool startScan(Neigbourhood type){ return true; }
+        void setSequence(const vector<int> & solution){ hasher.setSequence(solution); }
+
+        template<class Evaluate>
+        inline long int retrieve(const Move & move, long int cutoff, bool & pruned, Evaluate evaluate){
+            const std::uint64_t hash = hasher.getNeighbourHash(move);
+            auto search = memory.find(hash);
+            if(search != memory.end() && (!search->second.isLowerBound || search->second.objectiveScore > cutoff) &&
+               isNeighbour(search->second.solution, move)){
+                ++retrievalCount;
+                pruned = search->second.isLowerBound;
+                return search->second.objectiveScore;
+            }
+            ++missCount;
+            long int objectiveScore = evaluate(cutoff, pruned);
+            hashedMemoryEntry & entry = memory[hash];
+            entry.solution = hasher.getSequence();
+            applyMove(entry.solution, move);
+            entry.objectiveScore = objectiveScore;
+            entry.isLowerBound = pruned;
+            return objectiveScore;
+        }
+        long int size(){ return memory.size(); }
+        long int retrievals(){ return retrievalCount; }
+        long int misses(){ return missCount; }
+        long int evictions(){ return 0; }
+        float falsePositiveRate(){ return 0; }
+        std::string decisions(){ return ""; }
+        long int bytes(){
+            // bucket array and nodes with a next pointer, the hash and the entry
+            return memory.bucket_count() * sizeof(void*) + memory.size() * 
+                   (sizeof(void*) + sizeof(std::uint64_t) + sizeof(hashedMemoryEntry) + hasher.getSequence().size() * sizeof(int));
+        }
+};
+
+
+// flat set associative table with compact keys and a byte budget: every neighbour
+// can go in the emptiest of two buckets, and when both are full an entry of a 
+// bucket is evicted with the CLOCK algorithm (see flatmemory.cpp). The table is
+// keyed on the permutation hash of the neighbour.
+class FlatMemory{
+    private:
+        PermutationHash hasher;
+        FlatMemoryTable table;
+        long int retrievalCount = 0;
+        long int missCount = 0;
+
+    public:
+        static const bool enabled = true;
+
+        FlatMemory(int nbrOfJobs, Configuration & config): 
+            hasher(nbrOfJobs), table(nbrOfJobs, config.getMemoryBudget() * 1024 * 1024){}
+        bool startScan(Neigbourhood type){ return true; }
+        void setSequence(const vector<int> & solution){ hasher.setSequence(solution); }
+
+        template<class Evaluate>
+        inline long int retrieve(const Move & move, long int cutoff, bool & pruned, Evaluate evaluate){
+            const std::uint64_t hash = hasher.getNeighbourHash(move);
+            const long int slot = table.find(hash, hasher.getSequence(), move);
+            if(slot != NOT_FOUND && (!table.getIsLowerBound(slot) || table.getObjectiveScore(slot) > cutoff)){
+                ++retrievalCount;
+                pruned = table.getIsLowerBound(slot);
+                return table.getObjectiveScore(slot);
+            }
+            ++missCount;
+            long int objectiveScore = evaluate(cutoff, pruned);
+            if(slot != NOT_FOUND) table.update(slot, objectiveScore, pruned);
+            else table.insert(hash, hasher.getSequence(), move, objectiveScore, pruned);
+            return objectiveScore;
+        }
+        long int size(){ return table.size(); }
+        long int retrievals(){ return retrievalCount; }
+        long int misses(){ return missCount; }
+        long int evictions(){ return table.getEvictions(); }
+        long int bytes(){ return table.getBytes(); }
+        float falsePositiveRate(){ return 0; }
+        std::string decisions(){ return ""; }
+};
+
+
+// blocked Bloom filter of the permutation hashes of all evaluated neighbours with
+// a fixed footprint. It does not remember scores: a neighbour that was evaluated 
+// before had a score that was not better than the cutoff at that time, so as long
+// as the cutoff only goes down it can not beat the current cutoff and is skipped 
+// by returning NO_CUTOFF. When the cutoff goes up (a perturbation or restart of
+// ILS and IG) the filter is cleared. ANNEAL accepts worse neighbours and has no 
+// cutoff, it can not use this memory. A false positive skips a neighbour that was
+// never evaluated, the filter is cleared before the false positive rate exceeds 
+// the configured rate.
+class BloomMemory{
+    private:
+        PermutationHash hasher;
+        BlockedBloomFilter filter;
+        long int cutoffOfFilter = NO_CUTOFF;
+        long int revisitCount = 0;
+        long int missCount = 0;
+
+    public:
+        static const bool enabled = true;
+
+        BloomMemory(int nbrOfJobs, Configuration & config): 
+            hasher(nbrOfJobs), filter(config.getMemoryBudget() * 1024 * 1024, config.getFalsePositiveRate()){}
+        bool startScan(Neigbourhood type){ return true; }
+        void setSequence(const vector<int> & solution){ hasher.setSequence(solution); }
+
+        template<class Evaluate>
+        inline long int retrieve(const Move & move, long int cutoff, bool & pruned, Evaluate evaluate){
+            if(cutoff > cutoffOfFilter) filter.clear();
+            cutoffOfFilter = cutoff;
+            const std::uint64_t hash = hasher.getNeighbourHash(move);
+            if(filter.contains(hash)){
+                ++revisitCount;
+                return NO_CUTOFF;
+            }
+            ++missCount;
+            filter.insert(hash);
+            return evaluate(cutoff, pruned);
+        }
+        long int size(){ return filter.size(); }
+        long int retrievals(){ return revisitCount; }
+        long int misses(){ return missCount; }
+        long int evictions(){ return filter.getNbrOfEvictions(); }
+        long int bytes(){ return filter.getBytes(); }
+        float falsePositiveRate(){ return filter.getFalsePositiveRate(); }
+        std::string decisions(){ return ""; }
+};
+
+
+// flat table (as FLAT) that is only used for the neighbourhood types where it pays
+// off. The advisor samples the hit rate and the time of the lookups and evaluations,
+// switches the memory on and off per neighbourhood type and resizes the table
+// (see memoryadvisor.cpp). Scans without memory are scored up front by the batch 
+// evaluator when the pivoting rule allows it.
+class AdaptiveMemory{
+    private:
+        PermutationHash hasher;
+        FlatMemoryTable table;
+        MemoryAdvisor advisor;
+        long int retrievalCount = 0;
+        long int missCount = 0;
+
+        static inline double nanosecondsBetween(std::chrono::steady_clock::time_point start, 
+                                                std::chrono::steady_clock::time_point stop){
+            return std::chrono::duration<double, std::nano>(stop - start).count();
+        }
+
+    public:
+        static const bool enabled = true;
+
+        AdaptiveMemory(int nbrOfJobs, Configuration & config): 
+            hasher(nbrOfJobs), 
+            table(nbrOfJobs, std::min(ADAPTIVE_MEMORY_INITIAL_BUDGET, config.getMemoryBudget() * 1024 * 1024)),
+            advisor(ADAPTIVE_MEMORY_INITIAL_BUDGET, config.getMemoryBudget() * 1024 * 1024){}
+        bool startScan(Neigbourhood type){ return advisor.startScan(type); }
+        void setSequence(const vector<int> & solution){ hasher.setSequence(solution); }
+
+        template<class Evaluate>
+        inline long int retrieve(const Move & move, long int cutoff, bool & pruned, Evaluate evaluate){
+            const bool timed = advisor.isTimedLookup();
+            std::chrono::steady_clock::time_point start, found, evaluated, stored;
+            if(timed) start = std::chrono::steady_clock::now();
+
+            const std::uint64_t hash = hasher.getNeighbourHash(move);
+            const long int slot = table.find(hash, hasher.getSequence(), move);
+            long int objectiveScore;
+            const bool hit = slot != NOT_FOUND && (!table.getIsLowerBound(slot) || table.getObjectiveScore(slot) > cutoff);
+            if(timed) found = std::chrono::steady_clock::now();
+            if(hit){
+                ++retrievalCount;
+                pruned = table.getIsLowerBound(slot);
+                objectiveScore = table.getObjectiveScore(slot);
+            }
+            else{
+                ++missCount;
+                objectiveScore = evaluate(cutoff, pruned);
+                if(timed) evaluated = std::chrono::steady_clock::now();
+                if(slot != NOT_FOUND) table.update(slot, objectiveScore, pruned);
+                else table.insert(hash, hasher.getSequence(), move, objectiveScore, pruned);
+                if(timed) stored = std::chrono::steady_clock::now();
+            }
+
+            const double lookupTime = !timed ? 0 : hit ? nanosecondsBetween(start, found) : 
+                                      nanosecondsBetween(start, found) + nanosecondsBetween(evaluated, stored);
+            const double evaluationTime = (timed && !hit) ? nanosecondsBetween(found, evaluated) : 0;
+            if(advisor.recordLookup(hit, timed, lookupTime, evaluationTime, table.getEvictions()))
+                table.setByteBudget(advisor.getByteBudget());
+            return objectiveScore;
+        }
+        long int size(){ return table.size(); }
+        long int retrievals(){ return retrievalCount; }
+        long int misses(){ return missCount; }
+        long int evictions(){ return table.getEvictions(); }
+        long int bytes(){ return table.getBytes(); }
+        float falsePositiveRate(){ return 0; }
+        std::string decisions(){ return advisor.getDecisions(); }
+};
+
+
+/**********************************************************************************/
+/**
+ * ACCEPTANCE CRITERIA
+ * decide whether a neighbour replaces the best solution found so far
+ */
+/**********************************************************************************/
+struct StrictAcceptance{
+    static inline bool accept(long int objectiveScore, long int bestObjectiveScore, std::mt19937 & generator){
+        return objectiveScore < bestObjectiveScore;
+    }
+};
+
+// equal scores are accepted with a probability of one half
+struct RandomTieAcceptance{
+    static inline bool accept(long int objectiveScore, long int bestObjectiveScore, std::mt19937 & generator){
+        return (objectiveScore < bestObjectiveScore) ||
+               ((objectiveScore == bestObjectiveScore) && (generator() % 2) == 0);
+    }
+};
+
+#endif
@@ -4,12 +4,30 @@
 #include <vector>
 #include <string>
 #include <numeric>
+#include <algorithm>
+#include <random>
+#include <memory>
 
 #include "pfspinstance.h"
 #include "configuration.h"
 #include "initsolution.h"
 #include "neighbourhood.h"
 #include "helpers.h"
+#include "evaluator.h"
+#include "batchevaluator.h"
+#include "permutationhash.h"
+#include "flatmemory.h"
+#include "bloomfilter.h"
+#include "memoryadvisor.h"
+#include "coolingschedule.h"
+#include "deadline.h"
+#include "sharedincumbent.h"
+#include "mailbox.h"
+#include "threadpool.h"
+#include "population.h"
+#include "elitepool.h"
+#include "branchandbound.h"
+#include "solver.h"
 
 using std::string, std::endl;
 using std::vector;
@@ -38,6 +56,22 @@ int main(int argc, char *argv[]) {
     instance.readDataFromFile(config.getDatafile());
     
 
+    /****************************************************************************************/
+    // TEST PER JOB DATA
+    /****************************************************************************************/
+    printTitle("precomputed sum of processing times and WSPT ratio per job");
+    for(int job = 1; job <= instance.getNbrOfJobs(); ++job){
+        std::cout << "job " << job << ": " << instance.getSumOfProcessTimes(job)
+            << " " << instance.getWeightedSumOfProcessTimes(job) << endl;
+    }
+    std::cout << "sums should be: 9 6 8 7 7 and ratios: 9 3 2 3.5 2.33333" << endl;
+
+    printTitle("weighted tardiness of a schedule against the due dates and weights of its jobs");
+    vector<int> permutedSchedule = {0, 3, 1, 4, 5, 2};
+    std::cout << "weighted tardiness of 3 1 4 5 2: " << instance.computeSolutionTardiness(permutedSchedule) << endl;
+    std::cout << "should be: 49 (54 would mean the due dates and weights of the positions are used)" << endl;
+
+
     /****************************************************************************************/
     // TEST INITIAL SOLUTION
     /****************************************************************************************/
@@ -86,6 +120,295 @@ int main(int argc, char *argv[]) {
     std::cout << "makespan: " <<  metrics.makespan << endl;
     std::cout << "weighted tardiness: " <<  metrics.tardiness << endl;
 
+
+    printTitle("incremental evaluation of the exchange neighbourhood of solution 0 1 2 3 4 5");
+    CompletionTimesCache cache(instance);
+    cache.setSequence(solution);
+    neigbourhood = neighbourhoodExchange(solution);
+    for(vector<int> & neighbour : neigbourhood){
+        std::cout << cache.evaluate(neighbour,cache.getFirstDifference(neighbour)) << " ";
+        std::cout << instance.computeSolutionTardiness(neighbour) << endl;
+    }
+    std::cout << "both values on every line should be equal" << endl;
+
+    printTitle("evaluate all insertion positions of job 3 in partial solution 0 1 2 4 5");
+    vector<int> partial {0,1,2,4,5};
+    vector<long int> insertionScores;
+    cache.setSequence(partial);
+    cache.evaluateAllInsertions(3,insertionScores);
+    for(int position = 1; position <= partial.size(); ++position){
+        vector<int> candidate(partial);
+        candidate.insert(candidate.begin() + position, 3);
+        std::cout << insertionScores[position] << " " << instance.computeSolutionTardiness(candidate) << endl;
+    }
+    std::cout << "both values on every line should be equal" << endl;
+
+    printTitle("batch evaluation of the insert neighbourhood of solution 0 1 2 3 4 5");
+    cache.setSequence(solution);
+    neigbourhood = neighbourhoodInsert(solution);
+    vector<const vector<int>*> candidates;
+    for(vector<int> & neighbour : neigbourhood) candidates.push_back(&neighbour);
+    for(InstructionSet instructionSet : {SCALAR_LANES, AVX2_LANES, AVX512_LANES}){
+        BatchEvaluator batchEvaluator(instance, instructionSet);
+        vector<long int> batchScores(candidates.size());
+        batchEvaluator.evaluate(cache, candidates.data(), candidates.size(), batchScores.data());
+        std::cout << INSTRUCTION_SET_STRINGS[batchEvaluator.getInstructionSet()] << ": ";
+        printVector(batchScores);
+    }
+    std::cout << "all instruction sets should give: ";
+    for(vector<int> & neighbour : neigbourhood) std::cout << instance.computeSolutionTardiness(neighbour) << " ";
+    std::cout << endl;
+
+    printTitle("apply and undo the insert moves on solution 0 1 2 3 4 5 and evaluate them in a batch");
+    MoveGenerator insertMoves(INSERT, instance.getNbrOfJobs());
+    neigbourhood = neighbourhoodInsert(solution);
+    vector<int> working(solution);
+    bool movesMatch = true;
+    for(int index = 0; index < insertMoves.size(); ++index){
+        applyMove(working, insertMoves[index]);
+        movesMatch = movesMatch && (working == neigbourhood[index]);
+        undoMove(working, insertMoves[index]);
+        for(int position = 0; position < solution.size(); ++position)
+            movesMatch = movesMatch && (getJobAfterMove(solution, insertMoves[index], position) == neigbourhood[index][position]);
+    }
+    movesMatch = movesMatch && (working == solution);
+    std::cout << "moves match the insert neighbourhood: " << (movesMatch ? "yes" : "no") << endl;
+    cache.setSequence(solution);
+    BatchEvaluator moveEvaluator(instance);
+    vector<long int> moveScores(insertMoves.size());
+    moveEvaluator.evaluate(cache, insertMoves.data(), insertMoves.size(), moveScores.data());
+    printVector(moveScores);
+    std::cout << "moves should match and the scores should equal those of the batch evaluation above" << endl;
+
+    printTitle("hashes of the exchange and insert neighbours of solution 0 1 2 3 4 5 derived from the moves");
+    PermutationHash hasher(instance.getNbrOfJobs());
+    hasher.setSequence(solution);
+    bool hashesMatch = hasher.getHash() == hasher.computeHash(solution);
+    for(Neigbourhood type : {EXCHANGE, INSERT}){
+        MoveGenerator moves(type, instance.getNbrOfJobs());
+        for(int index = 0; index < moves.size(); ++index){
+            vector<int> neighbour(solution);
+            applyMove(neighbour, moves[index]);
+            hashesMatch = hashesMatch && (hasher.getNeighbourHash(moves[index]) == hasher.computeHash(neighbour));
+        }
+    }
+    std::cout << "derived hashes match the computed hashes: " << (hashesMatch ? "yes" : "no") << endl;
+    std::cout << "should be: yes" << endl;
+
+    printTitle("store the exchange neighbours of solution 0 1 2 3 4 5 in a flat memory of 300 bytes");
+    MoveGenerator exchangeMoves(EXCHANGE, instance.getNbrOfJobs());
+    FlatMemoryTable table(instance.getNbrOfJobs(), 300);
+    for(int index = 0; index < exchangeMoves.size(); ++index){
+        vector<int> neighbour(solution);
+        applyMove(neighbour, exchangeMoves[index]);
+        table.insert(hasher.getNeighbourHash(exchangeMoves[index]), solution, exchangeMoves[index],
+                     instance.computeSolutionTardiness(neighbour), false);
+    }
+    bool storedScoresMatch = true;
+    for(int index = 0; index < exchangeMoves.size(); ++index){
+        long int slot = table.find(hasher.getNeighbourHash(exchangeMoves[index]), solution, exchangeMoves[index]);
+        vector<int> neighbour(solution);
+        applyMove(neighbour, exchangeMoves[index]);
+        if(slot != NOT_FOUND) storedScoresMatch = storedScoresMatch && (table.getObjectiveScore(slot) == instance.computeSolutionTardiness(neighbour));
+    }
+    std::cout << "stored: " << table.size() << " evicted: " << table.getEvictions() << " bytes: " << table.getBytes() << endl;
+    std::cout << "stored scores match: " << (storedScoresMatch ? "yes" : "no") << endl;
+    std::cout << "stored and evicted should add up to 10, bytes should not exceed 300 and scores should match" << endl;
+
+    printTitle("shrink a flat memory of 4 kB with the exchange neighbours of solution 0 1 2 3 4 5 to 300 bytes");
+    FlatMemoryTable shrinkingTable(instance.getNbrOfJobs(), 4096);
+    for(int index = 0; index < exchangeMoves.size(); ++index)
+        shrinkingTable.insert(hasher.getNeighbourHash(exchangeMoves[index]), solution, exchangeMoves[index], index, false);
+    std::cout << "before: stored: " << shrinkingTable.size() << " bytes: " << shrinkingTable.getBytes() << endl;
+    shrinkingTable.setByteBudget(300);
+    std::cout << "after: stored: " << shrinkingTable.size() << " evicted: " << shrinkingTable.getEvictions() 
+              << " bytes: " << shrinkingTable.getBytes() << endl;
+    std::cout << "10 neighbours should be stored before, after stored and evicted should add up to 10" << endl;
+    std::cout << "and bytes should not exceed 300" << endl;
+
+    printTitle("advise the adaptive memory on lookups with fixed times");
+    MemoryAdvisor advisor(1024, 4096);
+    advisor.startScan(EXCHANGE);
+    for(int lookup = 0; lookup < ADAPTIVE_MEMORY_WINDOW; ++lookup) 
+        advisor.recordLookup(lookup % 100 == 0, true, 50, 400, 0);
+    std::cout << "EXCHANGE active after a hit rate of 0.01: " << (advisor.isActive(EXCHANGE) ? "yes" : "no") << endl;
+    for(int scan = 0; scan < ADAPTIVE_MEMORY_FIRST_PROBE; ++scan) advisor.startScan(EXCHANGE);
+    std::cout << "EXCHANGE probed again: " << (advisor.isActive(EXCHANGE) ? "yes" : "no") << endl;
+    for(int lookup = 0; lookup < ADAPTIVE_MEMORY_WINDOW; ++lookup) 
+        advisor.recordLookup(lookup % 2 == 0, true, 50, 400, lookup);
+    std::cout << "EXCHANGE active after a hit rate of 0.5: " << (advisor.isActive(EXCHANGE) ? "yes" : "no") << endl;
+    std::cout << "decisions: " << advisor.getDecisions() << endl;
+    std::cout << "should be: no yes yes and the decisions should switch EXCHANGE off at 4096 and on at 8192" << endl;
+    std::cout << "with the budget doubled to 2 kB" << endl;
+
+    printTitle("cool from temperature 100 with a fixed decay of 0.5 and a minimal temperature of 10");
+    CoolingSchedule coolingSchedule(FIXED, 0.5);
+    Deadline coolingDeadline(WALL, 1000);
+    coolingSchedule.start(100, 10, coolingDeadline);
+    for(int step = 0; step < 4; ++step){
+        coolingSchedule.cool();
+        std::cout << coolingSchedule.getTemperature() << " ";
+    }
+    std::cout << endl << "should be: 50 25 12.5 10" << endl;
+
+    printTitle("default time limits and a cancelled deadline");
+    std::cout << "default time limit of 50 jobs on 20 machines: " << getDefaultTimeLimit(50, 20) 
+              << " and of 7 jobs on 3 machines: " << getDefaultTimeLimit(7, 3) << endl;
+    Deadline deadline(WALL, 3600000);
+    deadline.start();
+    int checksBeforeExpiry = 0;
+    deadline.cancel();
+    while(!deadline.check()) ++checksBeforeExpiry;
+    std::cout << "checks before the cancelled deadline expired: " << checksBeforeExpiry << endl;
+    std::cout << "should be: 160000 and 3360, at most " << DEADLINE_CHECK_INTERVAL << " checks" << endl;
+
+    printTitle("a budget of 1000 evaluations");
+    Deadline evaluationDeadline(EVALS, 1000);
+    evaluationDeadline.start();
+    int evaluations = 0;
+    while(!evaluationDeadline.check()) ++evaluations;
+    std::cout << "evaluations before the deadline expired: " << evaluations 
+              << ", budget used: " << evaluationDeadline.getElapsed() << endl;
+    std::cout << "should be: 1000, 1000" << endl;
+
+    printTitle("publish solutions of chains 2, 1 and 3 with scores 50, 50 and 40 and chain 0 with score 40");
+    SharedIncumbent sharedIncumbent;
+    std::cout << sharedIncumbent.publish(50, {0,1,2}, 2) << " ";
+    std::cout << sharedIncumbent.publish(50, {0,2,1}, 1) << " ";
+    std::cout << sharedIncumbent.publish(40, {0,1,2}, 3) << " ";
+    std::cout << sharedIncumbent.publish(40, {0,2,1}, 0) << " ";
+    std::cout << sharedIncumbent.publish(45, {0,1,2}, 0) << endl;
+    std::cout << "owner: " << sharedIncumbent.getOwner() << ", score: " << sharedIncumbent.getObjectiveScore() 
+              << ", updates: " << sharedIncumbent.getNbrOfUpdates() << endl;
+    std::cout << "should be: 1 1 1 1 0, owner: 0, score: 40, updates: 4" << endl;
+
+    printTitle("receive from an empty mailbox, send 0 2 1 3 with score 40 and 0 3 2 1 with score 30 and receive twice");
+    Mailbox mailbox(4);
+    long int migrantScore = 0;
+    vector<int> migrant;
+    std::cout << mailbox.receive(migrantScore, migrant) << " ";
+    mailbox.send(40, {0,2,1,3});
+    mailbox.send(30, {0,3,2,1});
+    std::cout << mailbox.receive(migrantScore, migrant) << " ";
+    std::cout << migrantScore << " " << vectorToString(migrant) << " ";
+    std::cout << mailbox.receive(migrantScore, migrant) << endl;
+    vector<int> lastSent {0,3,2,1};
+    std::cout << "should be: 0 1 30 " << vectorToString(lastSent) << " 0" << endl;
+
+    printTitle("sum the squares of 0 to 999 twice on a pool of 4 threads");
+    ThreadPool threadPool(4);
+    vector<long int> squares(1000);
+    for(int round = 0; round < 2; ++round){
+        threadPool.run(squares.size(), [&](int task, int worker){ squares[task] = static_cast<long int>(task) * task + round; });
+        std::cout << std::accumulate(squares.begin(), squares.end(), 0L) << " ";
+    }
+    std::cout << endl << "should be: 332833500 332834500" << endl;
+
+    printTitle("100 OX, PMX and SJOX crossovers of 0 1 2 3 4 5 6 7 8 and 0 3 2 1 4 8 7 6 5, shifted");
+    vector<int> firstParent {0,1,2,3,4,5,6,7,8};
+    vector<int> secondParent {0,3,2,1,4,8,7,6,5};
+    vector<int> child(9), crossoverScratch;
+    std::mt19937 crossoverGenerator(1);
+    for(Crossover type : {OX, PMX, SJOX}){
+        bool permutations = true, commonKept = true;
+        for(int k = 0; k < 100; ++k){
+            crossover(type, firstParent.data(), secondParent.data(), child.data(), 8, crossoverGenerator, crossoverScratch);
+            commonKept = commonKept && child[2] == 2 && child[4] == 4;
+            shiftMutation(child.data(), 8, crossoverGenerator);
+            vector<int> sorted = child;
+            std::sort(sorted.begin(), sorted.end());
+            permutations = permutations && child[0] == 0 && sorted == firstParent;
+        }
+        std::cout << CROSSOVER_STRINGS[type] << " permutations: " << (permutations ? "yes" : "no")
+                  << ", common positions kept: " << (commonKept ? "yes" : "no") << endl;
+    }
+    std::cout << "should be: only permutations, the common positions 2 and 4 kept by PMX and SJOX" << endl;
+
+    printTitle("offer 0 1 2 3 4 (50) twice, 0 2 1 3 4 (60 and 40), 0 4 3 2 1 (70) and 0 3 4 1 2 (80) to a pool of 2");
+    ElitePool elitePool(2, 3, 4);
+    std::cout << elitePool.offer(50, {0,1,2,3,4}) << " " << elitePool.offer(50, {0,1,2,3,4}) << " ";
+    std::cout << elitePool.offer(60, {0,2,1,3,4}) << " " << elitePool.offer(40, {0,2,1,3,4}) << " ";
+    std::cout << elitePool.offer(70, {0,4,3,2,1}) << " " << elitePool.offer(80, {0,3,4,1,2}) << endl;
+    std::cout << "members: " << elitePool.getSize() << ", best score: " << elitePool.getObjectiveScore(elitePool.getBestMember()) << endl;
+    std::cout << "should be: 1 0 0 1 1 0, members: 2, best score: 40" << endl;
+
+    printTitle("branch and bound on the dummy data against all 120 schedules, scored exactly and on the cache");
+    vector<int> permutation {0,1,2,3,4,5};
+    long int bruteForceObjectiveScore = NO_CUTOFF;
+    bool cacheAgrees = true;
+    cache.setSequence(permutation);
+    do{
+        const long int exactObjectiveScore = instance.computeSolutionTardiness(permutation);
+        cacheAgrees = cacheAgrees && cache.evaluate(permutation, 1, NO_CUTOFF, nullptr) == exactObjectiveScore;
+        bruteForceObjectiveScore = std::min(bruteForceObjectiveScore, exactObjectiveScore);
+    } while(std::next_permutation(permutation.begin() + 1, permutation.end()));
+    Configuration branchAndBoundConfig = config;
+    branchAndBoundConfig.setNbrOfThreads(2);
+    solverResult exactResult = BranchAndBound(instance, branchAndBoundConfig).solve();
+    std::cout << "cache agrees: " << (cacheAgrees ? "yes" : "no") << ", best of all schedules: " << bruteForceObjectiveScore << endl;
+    std::cout << "branch and bound: " << exactResult.objectiveScore << ", proven lower bound: " << exactResult.lowerBound
+              << ", score of its schedule: " << instance.computeSolutionTardiness(exactResult.sequence) << endl;
+    std::cout << "should be: the cache agrees and all four scores are equal" << endl;
+
+    printTitle("SA, IG, TS and GA on two islands with a budget of 1 evaluation");
+    for(Pivotrules rule : {SA, IG, TS, GA}){
+        Configuration islandConfig = config;
+        islandConfig.setPivotingRule(rule);
+        islandConfig.setNbrOfChains(2);
+        islandConfig.setTimeLimit(EVALS, 1);
+        solverResult islandResult = solveSchedule(instance, islandConfig);
+        const bool scoreMatches = islandResult.sequence.size() == 6 &&
+                                  instance.computeSolutionTardiness(islandResult.sequence) == islandResult.objectiveScore;
+        std::cout << PIVOTING_RULE_STRINGS[rule] << " jobs: " << static_cast<int>(islandResult.sequence.size()) - 1 
+                  << ", score matches the schedule: " << (scoreMatches ? "yes" : "no") << endl;
+    }
+    std::cout << "should be: 5 jobs and a matching score for every rule" << endl;
+
+    printTitle("insert 1000 hashes in a Bloom filter of 4 kB with a false positive rate of 0.01");
+    BlockedBloomFilter filter(4096, 0.01);
+    bool allContained = true;
+    int falsePositives = 0;
+    for(std::uint64_t hash = 1; hash <= 1000; ++hash) filter.insert(hash * 0x9e3779b97f4a7c15ULL);
+    for(std::uint64_t hash = 1; hash <= 1000; ++hash) allContained = allContained && filter.contains(hash * 0x9e3779b97f4a7c15ULL);
+    for(std::uint64_t hash = 1001; hash <= 101000; ++hash) if(filter.contains(hash * 0x9e3779b97f4a7c15ULL)) ++falsePositives;
+    std::cout << "inserted hashes contained: " << (allContained ? "yes" : "no") << endl;
+    std::cout << "false positive rate: " << falsePositives / 100000.0 << " estimated: " << filter.getFalsePositiveRate() << endl;
+    std::cout << "inserted hashes should be contained and both rates should be close to or below 0.01" << endl;
+
+    printTitle("fill a Bloom filter of 64 kB with a false positive rate of 0.001 to its capacity");
+    BlockedBloomFilter fullFilter(65536, 0.001);
+    long int fullFalsePositives = 0;
+    for(std::uint64_t hash = 1; hash <= fullFilter.getCapacity(); ++hash) fullFilter.insert(hash * 0x9e3779b97f4a7c15ULL);
+    for(std::uint64_t hash = 1; hash <= 1000000; ++hash) 
+        if(fullFilter.contains((fullFilter.getCapacity() + hash) * 0x9e3779b97f4a7c15ULL)) ++fullFalsePositives;
+    std::cout << "capacity: " << fullFilter.getCapacity() << ", clears: " << fullFilter.getNbrOfClears() << endl;
+    std::cout << "false positive rate: " << fullFalsePositives / 1000000.0 << " estimated: " << fullFilter.getFalsePositiveRate() << endl;
+    std::cout << "should be: no clears, an estimated rate of 0.001 and a measured rate within 0.0001 of it" << endl;
+
+    printTitle("bounded evaluation of the exchange neighbourhood of solution 0 1 2 3 4 5 with cutoff 44");
+    cache.setSequence(solution);
+    neigbourhood = neighbourhoodExchange(solution);
+    for(vector<int> & neighbour : neigbourhood){
+        bool pruned;
+        long int score = cache.evaluate(neighbour, cache.getFirstDifference(neighbour), 44, &pruned);
+        std::cout << score << (pruned ? " pruned " : " exact ") << instance.computeSolutionTardiness(neighbour) << endl;
+    }
+    std::cout << "exact scores should equal the last value, pruned scores should be above 44" << endl;
+    std::cout << "and not above the last value" << endl;
+
+    printTitle("batch evaluation of the insert moves of solution 0 1 2 3 4 5 with cutoff 20");
+    cache.setSequence(solution);
+    for(InstructionSet instructionSet : {SCALAR_LANES, AVX2_LANES, AVX512_LANES}){
+        BatchEvaluator batchEvaluator(instance, instructionSet);
+        vector<long int> batchScores(insertMoves.size());
+        std::unique_ptr<bool[]> batchPruned(new bool[insertMoves.size()]);
+        batchEvaluator.evaluate(cache, insertMoves.data(), insertMoves.size(), batchScores.data(), 20, batchPruned.get());
+        std::cout << INSTRUCTION_SET_STRINGS[batchEvaluator.getInstructionSet()] << ": ";
+        for(int index = 0; index < insertMoves.size(); ++index) std::cout << batchPruned[index] << " ";
+        std::cout << endl;
+    }
+    std::cout << "should be: the same pruned flags for every instruction set" << endl;
+
     printHorizontalLine();
     
     return 0;
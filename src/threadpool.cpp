@@ -0,0 +1,199 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* file contains the pool of worker threads used to evaluate a neighbourhood in 
+/* parallel within one solve. The threads are started once and wait between runs,
+/* so that a run only costs a wake-up. A run executes a number of tasks and returns
+/* when all of them are done, the calling thread works along as worker 0. The task
+/* gets its own index and the index of the worker that executes it, so that a task
+/* can use the scratch memory of that worker. Every worker starts on an equal 
+/* contiguous share of the tasks and takes them from the front; a worker without
+/* tasks steals the back half of the tasks left to another worker, so that tasks of
+/* uneven length keep all workers busy. Which worker executes which task is not 
+/* fixed, the results of a task must only depend on its index.
+/********************************************************************************/
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <cstdint>
+#include <algorithm>
+
+#include "threadpool.h"
+
+
+/**********************************************************************************/
+/**
+ * @param first the first task of a range
+ * @param end the task after the last task of the range
+ * @return the range packed in 64 bits
+ */
+/**********************************************************************************/
+inline std::uint64_t packRange(std::uint32_t first, std::uint32_t end){
+    return (static_cast<std::uint64_t>(end) << 32) | first;
+}
+
+
+/**********************************************************************************/
+/**
+ * constructor, starts the worker threads
+ * @param nbrOfThreads the number of threads that execute the tasks, including the
+ *                     thread that calls run
+ */
+/**********************************************************************************/
+ThreadPool::ThreadPool(int nbrOfThreads): ranges(new TaskRange[std::max(nbrOfThreads, 1)]){
+    this->task = nullptr;
+    for(int worker = 0; worker < std::max(nbrOfThreads, 1); ++worker) ranges[worker].range.store(0);
+    this->busyWorkers = 0;
+    this->generation = 0;
+    this->stopping = false;
+    for(int worker = 1; worker < nbrOfThreads; ++worker)
+        workers.emplace_back(&ThreadPool::work, this, worker);
+}
+
+
+/**********************************************************************************/
+/**
+ * destructor, stops the worker threads
+ */
+/**********************************************************************************/
+ThreadPool::~ThreadPool(){
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    workAvailable.notify_all();
+    for(std::thread & worker : workers) worker.join();
+}
+
+
+/**********************************************************************************/
+/**
+ * @return the number of threads that execute the tasks, including the calling thread
+ */
+/**********************************************************************************/
+int ThreadPool::getNbrOfThreads(){
+    return workers.size() + 1;
+}
+
+
+/**********************************************************************************/
+/**
+ * takes the first task of the own range of a worker
+ * @param worker the index of the worker
+ * @return the index of the task, -1 when the range is empty
+ */
+/**********************************************************************************/
+int ThreadPool::takeTask(int worker){
+    std::uint64_t current = ranges[worker].range.load(std::memory_order_acquire);
+    while(true){
+        const std::uint32_t first = current, end = current >> 32;
+        if(first >= end) return -1;
+        if(ranges[worker].range.compare_exchange_weak(current, packRange(first + 1, end), std::memory_order_acq_rel)) 
+            return first;
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * steals the back half of the range of the first other worker with tasks left, the
+ * first stolen task is returned and the others become the own range of the worker.
+ * A range that is taken never holds its tasks again during the run, so the compare
+ * and exchange can not confuse an old range with a new one.
+ * @param worker the index of the stealing worker, whose own range is empty
+ * @return the index of the task, -1 when no other worker has tasks left
+ */
+/**********************************************************************************/
+int ThreadPool::stealTask(int worker){
+    const int nbrOfThreads = getNbrOfThreads();
+    for(int offset = 1; offset < nbrOfThreads; ++offset){
+        TaskRange & victim = ranges[(worker + offset) % nbrOfThreads];
+        std::uint64_t current = victim.range.load(std::memory_order_acquire);
+        while(true){
+            const std::uint32_t first = current, end = current >> 32;
+            if(first >= end) break;
+            const std::uint32_t middle = end - (end - first + 1) / 2;
+            if(!victim.range.compare_exchange_weak(current, packRange(first, middle), std::memory_order_acq_rel)) continue;
+            ranges[worker].range.store(packRange(middle + 1, end), std::memory_order_release);
+            return middle;
+        }
+    }
+    return -1;
+}
+
+
+/**********************************************************************************/
+/**
+ * executes tasks of the current run, first the own ones and then stolen ones, until
+ * none are left
+ * @param worker the index of the executing worker
+ */
+/**********************************************************************************/
+void ThreadPool::runTasks(int worker){
+    while(true){
+        int current = takeTask(worker);
+        if(current < 0) current = stealTask(worker);
+        if(current < 0) return;
+        (*task)(current, worker);
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * loop of a worker thread: waits for a new run, executes its tasks and reports 
+ * when it is done
+ * @param worker the index of the worker
+ */
+/**********************************************************************************/
+void ThreadPool::work(int worker){
+    long int lastGeneration = 0;
+    while(true){
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            workAvailable.wait(lock, [&]{ return stopping || generation != lastGeneration; });
+            if(stopping) return;
+            lastGeneration = generation;
+        }
+        runTasks(worker);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(--busyWorkers == 0) workDone.notify_one();
+        }
+    }
+}
+
+
+/**********************************************************************************/
+/**
+ * executes a number of tasks on the threads of the pool and returns when all of 
+ * them are done
+ * @param nbrOfTasks the number of tasks
+ * @param task the task, called with the index of the task and of the worker
+ */
+/**********************************************************************************/
+void ThreadPool::run(int nbrOfTasks, const std::function<void(int task, int worker)> & task){
+    if(workers.empty() || nbrOfTasks == 1){
+        for(int current = 0; current < nbrOfTasks; ++current) task(current, 0);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->task = &task;
+        const int nbrOfThreads = getNbrOfThreads();
+        for(int worker = 0; worker < nbrOfThreads; ++worker)
+            ranges[worker].range.store(packRange(static_cast<long int>(nbrOfTasks) * worker / nbrOfThreads,
+                                                 static_cast<long int>(nbrOfTasks) * (worker + 1) / nbrOfThreads), 
+                                       std::memory_order_relaxed);
+        busyWorkers = workers.size();
+        ++generation;
+    }
+    workAvailable.notify_all();
+    runTasks(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    workDone.wait(lock, [&]{ return busyWorkers == 0; });
+}
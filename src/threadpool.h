@@ -0,0 +1,55 @@
+/********************************************************************************/
+/* PERMUTATION FLOW-SHOP SCHEDULING PROBLEM
+/* headerfile for threadpool.cpp
+/********************************************************************************/
+#ifndef _THREADPOOL_H_
+#define _THREADPOOL_H_
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <cstdint>
+
+using std::vector;
+
+
+// class definition
+class ThreadPool{
+    private:
+        vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable workAvailable;
+        std::condition_variable workDone;
+
+        // the tasks of the current run not taken yet, per worker a range of task
+        // indexes with its first index in the low and its end in the high 32 bits,
+        // every range on its own cache line
+        struct alignas(64) TaskRange{
+            std::atomic<std::uint64_t> range;
+        };
+        const std::function<void(int, int)> * task;
+        std::unique_ptr<TaskRange[]> ranges;
+
+        // workers that did not finish the current run, every run is a new generation
+        int busyWorkers;
+        long int generation;
+        bool stopping;
+
+        void work(int worker);
+        int takeTask(int worker);
+        int stealTask(int worker);
+        void runTasks(int worker);
+
+    public:
+        ThreadPool(int nbrOfThreads);
+        ~ThreadPool();
+
+        int getNbrOfThreads();
+        void run(int nbrOfTasks, const std::function<void(int task, int worker)> & task);
+};
+
+#endif